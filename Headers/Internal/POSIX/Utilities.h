@@ -95,4 +95,20 @@ streamsize WriteSome(NativeHandle handle, span<const byte> buffer);
 /// \throw std::system_error In case of error.
 size_t GetBufferSize(NativeHandle handle);
 
+
+#if defined(__linux__)
+/// \brief Maps the memory of the given size twice in a row so that accessing
+/// the bytes past the end of the first mapping accesses the start of it.
+/// \param[in] size Size of the memory in bytes.
+/// \return Pointer to the first mapping or nullptr if mapping failed or size
+/// is not a multiple of the page size.
+/// \note Only available on Linux since it relies on memfd_create.
+byte* MapMirroredMemory(size_t size) noexcept;
+
+/// \brief Unmaps the memory that was mapped by MapMirroredMemory.
+/// \param[in] memory Pointer returned by MapMirroredMemory.
+/// \param[in] size Size of the memory in bytes.
+void UnmapMirroredMemory(byte* memory, size_t size) noexcept;
+#endif
+
 }
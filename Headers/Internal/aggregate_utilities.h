@@ -0,0 +1,94 @@
+/// \file
+/// \brief Internal header file that describes the utility functions for
+/// enumerating fields of aggregates.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "format.h"
+#include "format_utilities.h"
+
+namespace std::io::Utilities
+{
+
+/// \brief Maximum amount of fields of the aggregate that can be enumerated.
+inline constexpr size_t MaxAggregateFields = 16;
+
+/// \brief Returns the amount of fields of the aggregate.
+/// \details Fields are counted by trying to brace-initialize the aggregate
+/// from the growing amount of objects convertible to anything. Because of the
+/// brace elision this doesn't work with the members that are built-in arrays.
+/// \tparam T Type of the aggregate.
+/// \return Amount of fields.
+template <typename T>
+consteval size_t CountFields() noexcept;
+
+/// \brief A concept specifying aggregate whose fields can be enumerated.
+template <typename T>
+concept reflectable_aggregate = is_class_v<T> && is_aggregate_v<T> &&
+	!ranges::range<T> && (CountFields<T>() > 0) &&
+	(CountFields<T>() <= MaxAggregateFields);
+
+/// \brief Returns the tuple of references to the fields of the aggregate.
+/// \tparam T Type of the aggregate, possibly const.
+/// \param[in] object Aggregate to take fields of.
+/// \return Tuple of references to the fields.
+template <typename T>
+requires reflectable_aggregate<remove_const_t<T>>
+constexpr auto TieFields(T& object) noexcept;
+
+/// \brief Calls the given function for every field of the aggregate in order
+/// of declaration.
+/// \tparam T Type of the aggregate, possibly const.
+/// \param[in,out] object Aggregate to enumerate fields of.
+/// \param[in] f Function to call.
+template <typename T>
+requires reflectable_aggregate<remove_const_t<T>>
+constexpr void ForEachField(T& object, auto&& f);
+
+/// \brief Returns the size of the type if its object representation is the
+/// same as its serialized representation in the native format.
+/// \tparam T Type to check.
+/// \return Size of the type or 0 if type can't be serialized bitwise.
+template <typename T>
+consteval size_t GetBitwiseSize() noexcept;
+
+/// \brief A concept specifying type whose object representation is the same
+/// as its serialized representation in the native format.
+/// \details Such types are integers except bool, bytes, sane ISO 60559 types
+/// and aggregates of them without padding. Bools are excluded because not all
+/// byte values are valid bools.
+template <typename T>
+concept bitwise_serializable = is_trivially_copyable_v<T> &&
+	(GetBitwiseSize<T>() == sizeof(T));
+
+/// \brief A concept specifying resizable contiguous container of bytes other
+/// than string, such as std::vector<std::byte>.
+/// \details At the top level such containers are transferred as raw bytes of
+/// their current size. Nested in other types they are prefixed with length.
+template <typename T>
+concept byte_container = ranges::contiguous_range<T> &&
+	ranges::sized_range<T> && same_as<ranges::range_value_t<T>, byte> &&
+	!requires { typename T::traits_type; } &&
+	requires(T& container, size_t size)
+	{
+		container.resize(size);
+	};
+
+/// \brief Checks if the given format matches the native object representation
+/// of the bitwise serializable type.
+/// \tparam T Type to check.
+/// \param[in] f Format to check.
+/// \return True if objects of T can be transferred as raw bytes.
+template <bitwise_serializable T>
+constexpr bool IsNativeRepresentation(format f) noexcept;
+
+}
+
+#include "aggregate_utilities.hpp"
@@ -0,0 +1,197 @@
+/// \file
+/// \brief Internal header file that contains implementation of the utility
+/// functions for enumerating fields of aggregates.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+namespace std::io::Utilities
+{
+
+/// \brief Object that is implicitly convertible to any type. Only used in
+/// unevaluated context.
+/// \tparam I Index of the field. Only used to expand packs.
+template <size_t I>
+struct AnyField
+{
+	template <typename T>
+	operator T() const noexcept;
+};
+
+template <typename T, size_t... I>
+consteval bool IsBraceConstructible(index_sequence<I...>) noexcept
+{
+	return requires
+	{
+		T{AnyField<I>{}...};
+	};
+}
+
+template <typename T>
+consteval size_t CountFields() noexcept
+{
+	size_t count = 0;
+	[&]<size_t... I>(index_sequence<I...>)
+	{
+		// Stop at the first amount of initializers that is not accepted.
+		((IsBraceConstructible<T>(make_index_sequence<I + 1>{}) ?
+			(count = I + 1, true) : false) && ...);
+	}(make_index_sequence<MaxAggregateFields + 1>{});
+	return count;
+}
+
+template <typename T>
+requires reflectable_aggregate<remove_const_t<T>>
+constexpr auto TieFields(T& object) noexcept
+{
+	constexpr auto count = CountFields<remove_const_t<T>>();
+	if constexpr (count == 1)
+	{
+		auto& [f0] = object;
+		return tie(f0);
+	}
+	else if constexpr (count == 2)
+	{
+		auto& [f0, f1] = object;
+		return tie(f0, f1);
+	}
+	else if constexpr (count == 3)
+	{
+		auto& [f0, f1, f2] = object;
+		return tie(f0, f1, f2);
+	}
+	else if constexpr (count == 4)
+	{
+		auto& [f0, f1, f2, f3] = object;
+		return tie(f0, f1, f2, f3);
+	}
+	else if constexpr (count == 5)
+	{
+		auto& [f0, f1, f2, f3, f4] = object;
+		return tie(f0, f1, f2, f3, f4);
+	}
+	else if constexpr (count == 6)
+	{
+		auto& [f0, f1, f2, f3, f4, f5] = object;
+		return tie(f0, f1, f2, f3, f4, f5);
+	}
+	else if constexpr (count == 7)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6);
+	}
+	else if constexpr (count == 8)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6, f7] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6, f7);
+	}
+	else if constexpr (count == 9)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+	}
+	else if constexpr (count == 10)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+	}
+	else if constexpr (count == 11)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+	}
+	else if constexpr (count == 12)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+	}
+	else if constexpr (count == 13)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+	}
+	else if constexpr (count == 14)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12,
+			f13] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+	}
+	else if constexpr (count == 15)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13,
+			f14] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13,
+			f14);
+	}
+	else if constexpr (count == 16)
+	{
+		auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14,
+			f15] = object;
+		return tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13,
+			f14, f15);
+	}
+}
+
+template <typename T>
+requires reflectable_aggregate<remove_const_t<T>>
+constexpr void ForEachField(T& object, auto&& f)
+{
+	apply([&](auto&... fields)
+	{
+		(f(fields), ...);
+	}, TieFields(object));
+}
+
+template <typename T>
+consteval size_t GetBitwiseSize() noexcept
+{
+	if constexpr (same_as<T, bool>)
+	{
+		return 0;
+	}
+	else if constexpr (integral<T> || iso60559_sane<T> || same_as<T, byte>)
+	{
+		return sizeof(T);
+	}
+	else if constexpr (reflectable_aggregate<T>)
+	{
+		using Fields = decltype(TieFields(declval<T&>()));
+		return []<size_t... I>(index_sequence<I...>)
+		{
+			array<size_t, sizeof...(I)> sizes{GetBitwiseSize<remove_cvref_t<
+				tuple_element_t<I, Fields>>>()...};
+			// Any field that isn't bitwise serializable poisons the whole
+			// aggregate.
+			size_t size = 0;
+			for (auto field_size : sizes)
+			{
+				if (field_size == 0)
+				{
+					return size_t{0};
+				}
+				size += field_size;
+			}
+			return size;
+		}(make_index_sequence<tuple_size_v<Fields>>{});
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+template <bitwise_serializable T>
+constexpr bool IsNativeRepresentation(format f) noexcept
+{
+	// Both native and ISO 60559 floating point formats have native
+	// representation because only sane ISO 60559 types are bitwise
+	// serializable.
+	auto float_format = f.get_floating_point_format();
+	return (f.get_endianness() == endian::native) &&
+		(f.get_integer_format() == integer_format::fixed) &&
+		((float_format == floating_point_format::native) ||
+		(float_format == floating_point_format::iec559));
+}
+
+}
@@ -0,0 +1,72 @@
+/// \file
+/// \brief Internal header file that describes the alignment class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <cstddef>
+
+#include "context_concepts.h"
+
+namespace std::io
+{
+
+/// \brief Directive that aligns the stream position.
+/// \details Writing the directive writes zero bytes until the stream position
+/// is a multiple of the alignment. Reading it skips the same amount of bytes.
+/// Alignment is relative to the beginning of the stream so the stream must be
+/// seekable. Data written with page alignment keeps the natural alignment of
+/// its values when the whole stream is mapped to memory.
+
+class alignment final
+{
+public:
+	// Constructor
+	constexpr explicit alignment(size_t value);
+	
+	// Value
+	constexpr size_t get_value() const noexcept;
+	
+	// Serialization
+	template <typename I>
+	requires input_stream<I> || input_context<I>
+	constexpr void read(I& i) const;
+	template <typename O>
+	requires output_stream<O> || output_context<O>
+	constexpr void write(O& o) const;
+private:
+	size_t m_value; ///< Alignment in bytes.
+};
+
+namespace Utilities
+{
+
+/// \brief Returns the amount of padding bytes needed to align the position.
+/// \param[in] pos Position to align.
+/// \param[in] alignment Alignment in bytes.
+/// \return Amount of padding bytes.
+constexpr size_t GetPaddingSize(streamoff pos, size_t alignment) noexcept;
+
+/// \brief Writes zero bytes until the stream position is aligned.
+/// \param[in] alignment Alignment in bytes.
+/// \param[in,out] s Stream to write to.
+/// \throw std::io::io_error If writing has failed.
+template <output_stream S>
+requires seekable_stream<S>
+constexpr void PadToAlignment(size_t alignment, S& s);
+
+/// \brief Skips bytes until the stream position is aligned.
+/// \param[in] alignment Alignment in bytes.
+/// \param[in,out] s Stream to read from.
+/// \throw std::io::io_error If the stream has ended before the aligned
+/// position or if reading has failed.
+template <input_stream S>
+requires seekable_stream<S>
+constexpr void SkipToAlignment(size_t alignment, S& s);
+
+}
+
+}
+
+#include "alignment.hpp"
@@ -0,0 +1,105 @@
+/// \file
+/// \brief Internal header file that contains implementation of the alignment
+/// class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+#include "io_error.h"
+#include "read_raw.h"
+#include "write_raw.h"
+
+namespace std::io
+{
+
+constexpr alignment::alignment(size_t value)
+	: m_value{value}
+{
+	if (value == 0)
+	{
+		throw io_error{"alignment", io_errc::invalid_argument};
+	}
+}
+
+constexpr size_t alignment::get_value() const noexcept
+{
+	return m_value;
+}
+
+template <typename I>
+requires input_stream<I> || input_context<I>
+constexpr void alignment::read(I& i) const
+{
+	if constexpr (input_context<I>)
+	{
+		Utilities::SkipToAlignment(m_value, i.get_stream());
+	}
+	else
+	{
+		Utilities::SkipToAlignment(m_value, i);
+	}
+}
+
+template <typename O>
+requires output_stream<O> || output_context<O>
+constexpr void alignment::write(O& o) const
+{
+	if constexpr (output_context<O>)
+	{
+		Utilities::PadToAlignment(m_value, o.get_stream());
+	}
+	else
+	{
+		Utilities::PadToAlignment(m_value, o);
+	}
+}
+
+namespace Utilities
+{
+
+constexpr size_t GetPaddingSize(streamoff pos, size_t alignment) noexcept
+{
+	auto remainder = static_cast<size_t>(pos) % alignment;
+	return (remainder == 0) ? 0 : alignment - remainder;
+}
+
+/// \brief Size of the buffer used to write or skip padding.
+inline constexpr size_t PaddingChunkSize = 64;
+
+template <output_stream S>
+requires seekable_stream<S>
+constexpr void PadToAlignment(size_t alignment, S& s)
+{
+	auto padding = GetPaddingSize(s.get_position().value(), alignment);
+	constexpr array<byte, PaddingChunkSize> zeroes{};
+	while (padding > 0)
+	{
+		auto size = min(padding, zeroes.size());
+		auto bytes = span<const byte>{zeroes}.first(size);
+		write_raw(bytes, s);
+		padding -= size;
+	}
+}
+
+template <input_stream S>
+requires seekable_stream<S>
+constexpr void SkipToAlignment(size_t alignment, S& s)
+{
+	auto padding = GetPaddingSize(s.get_position().value(), alignment);
+	array<byte, PaddingChunkSize> skipped;
+	while (padding > 0)
+	{
+		auto size = min(padding, skipped.size());
+		auto bytes = span<byte>{skipped}.first(size);
+		read_raw(bytes, s);
+		padding -= size;
+	}
+}
+
+}
+
+}
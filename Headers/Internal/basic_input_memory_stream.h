@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <memory_resource>
 #include <vector>
 
 namespace std::io
@@ -24,6 +25,14 @@ public:
 	
 	// Reading
 	constexpr streamsize read_some(span<byte> buffer);
+	template <typename T>
+	requires is_trivially_copyable_v<T> && (!is_const_v<T>) &&
+		ranges::contiguous_range<Container>
+	span<const T> read_view(size_t count);
+	template <typename T>
+	requires is_trivially_copyable_v<T> && (!is_const_v<T>) &&
+		ranges::contiguous_range<Container>
+	span<const T> read_view(size_t count, span<T> storage);
 	
 	// Buffer management
 	constexpr const Container& get_buffer() const & noexcept;
@@ -37,6 +46,13 @@ private:
 
 using input_memory_stream = basic_input_memory_stream<vector<byte>>;
 
+namespace pmr
+{
+
+using input_memory_stream = basic_input_memory_stream<std::pmr::vector<byte>>;
+
+}
+
 }
 
 #include "basic_input_memory_stream.hpp"
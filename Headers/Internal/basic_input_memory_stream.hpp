@@ -30,6 +30,25 @@ constexpr streamsize basic_input_memory_stream<Container>::read_some(
 	return Utilities::ReadSome(m_buffer, this->m_position, buffer);
 }
 
+template <typename Container>
+template <typename T>
+requires is_trivially_copyable_v<T> && (!is_const_v<T>) &&
+	ranges::contiguous_range<Container>
+span<const T> basic_input_memory_stream<Container>::read_view(size_t count)
+{
+	return Utilities::ReadView<T>(m_buffer, this->m_position, count, span<T>{});
+}
+
+template <typename Container>
+template <typename T>
+requires is_trivially_copyable_v<T> && (!is_const_v<T>) &&
+	ranges::contiguous_range<Container>
+span<const T> basic_input_memory_stream<Container>::read_view(size_t count,
+	span<T> storage)
+{
+	return Utilities::ReadView(m_buffer, this->m_position, count, storage);
+}
+
 template <typename Container>
 constexpr const Container& basic_input_memory_stream<Container>::get_buffer()
 	const & noexcept
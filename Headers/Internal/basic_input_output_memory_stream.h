@@ -6,12 +6,18 @@
 
 #pragma once
 
+#include <memory_resource>
+
+#include "buffer_pool.h"
+#include "growth_policy.h"
+
 namespace std::io
 {
 
-template <typename Container>
+template <typename Container,
+	Utilities::growth_policy Growth = geometric_growth>
 class basic_input_output_memory_stream final :
-	public PositionHelper<basic_input_output_memory_stream<Container>,
+	public PositionHelper<basic_input_output_memory_stream<Container, Growth>,
 		typename Container::difference_type>
 {
 public:
@@ -19,12 +25,16 @@ public:
 	constexpr basic_input_output_memory_stream() = default;
 	constexpr basic_input_output_memory_stream(const Container& c);
 	constexpr basic_input_output_memory_stream(Container&& c);
+	template <typename C = Container>
+	constexpr explicit basic_input_output_memory_stream(
+		const typename C::allocator_type& allocator);
 	
 	// Reading
 	constexpr streamsize read_some(span<byte> buffer);
 	
 	// Writing
 	constexpr streamsize write_some(span<const byte> buffer);
+	constexpr span<byte> write_uninitialized(size_t count);
 	
 	// Buffer management
 	constexpr const Container& get_buffer() const & noexcept;
@@ -32,13 +42,32 @@ public:
 	constexpr void set_buffer(const Container& new_buffer);
 	constexpr void set_buffer(Container&& new_buffer);
 	constexpr void reset_buffer() noexcept;
+	void set_buffer(buffer_pool& pool, size_t capacity)
+		requires same_as<Container, vector<byte>>;
+	void reset_buffer(buffer_pool& pool) noexcept
+		requires same_as<Container, vector<byte>>;
+	constexpr size_t get_capacity() const noexcept;
+	constexpr void reserve(size_t new_capacity);
+	
+	// Growth
+	constexpr const Growth& get_growth_policy() const noexcept;
+	constexpr void set_growth_policy(Growth growth) noexcept;
 private:
 	Container m_buffer;
+	[[no_unique_address]] Growth m_growth; ///< Growth policy of the buffer.
 };
 
 using input_output_memory_stream = basic_input_output_memory_stream<vector<
 	byte>>;
 
+namespace pmr
+{
+
+using input_output_memory_stream = basic_input_output_memory_stream<
+	std::pmr::vector<byte>>;
+
+}
+
 }
 
 #include "basic_input_output_memory_stream.hpp"
@@ -9,70 +9,136 @@
 namespace std::io
 {
 
-template <typename Container>
-constexpr basic_input_output_memory_stream<Container>::
+template <typename Container, Utilities::growth_policy Growth>
+constexpr basic_input_output_memory_stream<Container, Growth>::
 	basic_input_output_memory_stream(const Container& c)
 	: m_buffer{c}
 {
 }
 
-template <typename Container>
-constexpr basic_input_output_memory_stream<Container>::
+template <typename Container, Utilities::growth_policy Growth>
+constexpr basic_input_output_memory_stream<Container, Growth>::
 	basic_input_output_memory_stream(Container&& c)
 	: m_buffer{move(c)}
 {
 }
 
-template <typename Container>
-constexpr streamsize basic_input_output_memory_stream<Container>::read_some(
-	span<byte> buffer)
+template <typename Container, Utilities::growth_policy Growth>
+template <typename C>
+constexpr basic_input_output_memory_stream<Container, Growth>::
+	basic_input_output_memory_stream(
+		const typename C::allocator_type& allocator)
+	: m_buffer(allocator)
+{
+}
+
+template <typename Container, Utilities::growth_policy Growth>
+constexpr streamsize basic_input_output_memory_stream<Container, Growth>::
+	read_some(span<byte> buffer)
 {
 	return Utilities::ReadSome(m_buffer, this->m_position, buffer);
 }
 
-template <typename Container>
-constexpr streamsize basic_input_output_memory_stream<Container>::write_some(
-	span<const byte> buffer)
+template <typename Container, Utilities::growth_policy Growth>
+constexpr streamsize basic_input_output_memory_stream<Container, Growth>::
+	write_some(span<const byte> buffer)
 {
-	return Utilities::WriteSomeDynamic(m_buffer, this->m_position, buffer);
+	return Utilities::WriteSomeDynamic(m_buffer, this->m_position, buffer,
+		m_growth);
 }
 
-template <typename Container>
-constexpr const Container& basic_input_output_memory_stream<Container>::
+template <typename Container, Utilities::growth_policy Growth>
+constexpr span<byte> basic_input_output_memory_stream<Container, Growth>::
+	write_uninitialized(size_t count)
+{
+	return Utilities::WriteUninitialized(m_buffer, this->m_position, count,
+		m_growth);
+}
+
+template <typename Container, Utilities::growth_policy Growth>
+constexpr const Container& basic_input_output_memory_stream<Container, Growth>::
 	get_buffer() const & noexcept
 {
 	return m_buffer;
 }
 
-template <typename Container>
-constexpr Container basic_input_output_memory_stream<Container>::get_buffer() &&
-	noexcept
+template <typename Container, Utilities::growth_policy Growth>
+constexpr Container basic_input_output_memory_stream<Container, Growth>::
+	get_buffer() && noexcept
 {
 	return move(m_buffer);
 }
 
-template <typename Container>
-constexpr void basic_input_output_memory_stream<Container>::set_buffer(
-	const Container& new_buffer)
+template <typename Container, Utilities::growth_policy Growth>
+constexpr void basic_input_output_memory_stream<Container, Growth>::
+	set_buffer(const Container& new_buffer)
 {
 	m_buffer = new_buffer;
 	this->m_position = 0;
 }
 
-template <typename Container>
-constexpr void basic_input_output_memory_stream<Container>::set_buffer(
-	Container&& new_buffer)
+template <typename Container, Utilities::growth_policy Growth>
+constexpr void basic_input_output_memory_stream<Container, Growth>::
+	set_buffer(Container&& new_buffer)
 {
 	m_buffer = move(new_buffer);
 	this->m_position = 0;
 }
 
-template <typename Container>
-constexpr void basic_input_output_memory_stream<Container>::reset_buffer()
-	noexcept
+template <typename Container, Utilities::growth_policy Growth>
+constexpr void basic_input_output_memory_stream<Container, Growth>::
+	reset_buffer() noexcept
 {
 	m_buffer.clear();
 	this->m_position = 0;
 }
 
+template <typename Container, Utilities::growth_policy Growth>
+void basic_input_output_memory_stream<Container, Growth>::
+	set_buffer(buffer_pool& pool, size_t capacity)
+	requires same_as<Container, vector<byte>>
+{
+	auto new_buffer = pool.acquire(capacity);
+	pool.release(move(m_buffer));
+	m_buffer = move(new_buffer);
+	this->m_position = 0;
+}
+
+template <typename Container, Utilities::growth_policy Growth>
+void basic_input_output_memory_stream<Container, Growth>::
+	reset_buffer(buffer_pool& pool) noexcept
+	requires same_as<Container, vector<byte>>
+{
+	pool.release(move(m_buffer));
+	m_buffer.clear();
+	this->m_position = 0;
+}
+
+template <typename Container, Utilities::growth_policy Growth>
+constexpr size_t basic_input_output_memory_stream<Container, Growth>::
+	get_capacity() const noexcept
+{
+	return static_cast<size_t>(m_buffer.capacity());
+}
+
+template <typename Container, Utilities::growth_policy Growth>
+constexpr void basic_input_output_memory_stream<Container, Growth>::
+	reserve(size_t new_capacity)
+{
+	m_buffer.reserve(new_capacity);
+}
+
+template <typename Container, Utilities::growth_policy Growth>
+constexpr const Growth& basic_input_output_memory_stream<Container, Growth>::
+	get_growth_policy() const noexcept
+{
+	return m_growth;
+}
+
+template <typename Container, Utilities::growth_policy Growth>
+constexpr void basic_input_output_memory_stream<Container, Growth>::
+	set_growth_policy(Growth growth) noexcept
+{
+	m_growth = growth;
+}
 }
@@ -0,0 +1,74 @@
+/// \file
+/// \brief Internal header file that describes the utility functions for
+/// bit-packed data.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <climits>
+#include <cstdint>
+
+#include "format_utilities.h"
+
+namespace std::io::Utilities
+{
+
+/// \brief Amount of bytes that must be readable past the byte containing the
+/// start of the last value passed to UnpackBits.
+inline constexpr size_t UnpackBitsPadding = 2 * sizeof(uint64_t);
+
+/// \brief Returns the mask of the given amount of low bits.
+/// \param[in] count Amount of bits. Must be in [0, 64] range.
+/// \return Mask.
+constexpr uint64_t GetBitMask(int count) noexcept;
+
+/// \brief Loads little endian 64-bit word from unaligned memory.
+/// \param[in] data Pointer to the first byte of the word.
+/// \return Loaded word.
+constexpr uint64_t LoadLittleEndian64(const byte* data) noexcept;
+
+/// \brief Stores 64-bit word to unaligned memory as little endian.
+/// \param[in] value Word to store.
+/// \param[out] data Pointer to the first byte of the word.
+constexpr void StoreLittleEndian64(uint64_t value, byte* data) noexcept;
+
+/// \brief Unpacks the array of unsigned integers of fixed bit width.
+/// \details Values are stored least significant bit first, starting from the
+/// least significant bit of each byte.
+/// \tparam T Type of the values.
+/// \param[in] in_buffer Packed bits. Must have UnpackBitsPadding readable
+/// bytes past the byte containing the start of the last value. Bits past the
+/// last value are ignored.
+/// \param[in] bit_offset Offset of the first value in bits.
+/// \param[in] width Width of each value in bits. Must be in [1, bit width of T]
+/// range.
+/// \param[out] out_buffer Buffer to unpack to.
+template <unsigned_integral T>
+/*constexpr*/ void UnpackBits(span<const byte> in_buffer, size_t bit_offset,
+	int width, span<T> out_buffer) noexcept;
+
+/// \brief Packs the array of unsigned integers to the given bit width.
+/// \details Values are stored the same way UnpackBits expects them. Bits of
+/// values above the width are ignored.
+/// \tparam T Type of the values.
+/// \param[in] in_buffer Values to pack.
+/// \param[in] width Width of each value in bits. Must be in [0, bit width of T]
+/// range.
+/// \param[out] out_buffer Buffer to pack to. Must have at least
+/// GetPackedSize bytes.
+/// \return Amount of bytes written.
+template <unsigned_integral T>
+/*constexpr*/ size_t PackBits(span<const T> in_buffer, int width,
+	span<byte> out_buffer) noexcept;
+
+/// \brief Returns the amount of bytes needed to pack the given amount of
+/// values.
+/// \param[in] count Amount of values.
+/// \param[in] width Width of each value in bits.
+/// \return Amount of bytes.
+constexpr size_t GetPackedSize(size_t count, int width) noexcept;
+
+}
+
+#include "bit_packing_utilities.hpp"
@@ -0,0 +1,165 @@
+/// \file
+/// \brief Internal header file that contains implementation of the utility
+/// functions for bit-packed data.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace std::io::Utilities
+{
+
+constexpr uint64_t GetBitMask(int count) noexcept
+{
+	return (count >= 64) ? ~uint64_t{0} : (uint64_t{1} << count) - 1;
+}
+
+constexpr uint64_t LoadLittleEndian64(const byte* data) noexcept
+{
+	if constexpr (endian::native == endian::little)
+	{
+		return LoadObject<uint64_t>(span<const byte>{data, sizeof(uint64_t)});
+	}
+	else
+	{
+		uint64_t result = 0;
+		for (size_t i = 0; i < sizeof(result); ++i)
+		{
+			result |= to_integer<uint64_t>(data[i]) << (CHAR_BIT * i);
+		}
+		return result;
+	}
+}
+
+constexpr void StoreLittleEndian64(uint64_t value, byte* data) noexcept
+{
+	if constexpr (endian::native == endian::little)
+	{
+		StoreObject(value, span<byte>{data, sizeof(value)});
+	}
+	else
+	{
+		for (size_t i = 0; i < sizeof(value); ++i)
+		{
+			data[i] = byte{static_cast<unsigned char>(value >> (CHAR_BIT * i))};
+		}
+	}
+}
+
+template <unsigned_integral T>
+/*constexpr*/ void UnpackBits(span<const byte> in_buffer, size_t bit_offset,
+	int width, span<T> out_buffer) noexcept
+{
+	auto data = ranges::data(in_buffer);
+	auto mask = GetBitMask(width);
+	size_t i = 0;
+#if defined(__AVX2__)
+	if constexpr ((sizeof(T) == sizeof(uint32_t)) &&
+		(endian::native == endian::little))
+	{
+		// Each value is gathered as a 32-bit word starting at its first byte,
+		// which holds the whole value if it is at most 25 bits wide.
+		if (width <= 25)
+		{
+			auto widths = _mm256_set1_epi32(width);
+			auto lane_offsets = _mm256_mullo_epi32(
+				_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), widths);
+			auto value_mask = _mm256_set1_epi32(static_cast<int>(mask));
+			auto bit_mask = _mm256_set1_epi32(CHAR_BIT - 1);
+			for (; i + 8 <= out_buffer.size(); i += 8)
+			{
+				auto bit = bit_offset + i * width;
+				auto offsets = _mm256_add_epi32(lane_offsets,
+					_mm256_set1_epi32(static_cast<int>(bit % CHAR_BIT)));
+				auto words = _mm256_i32gather_epi32(
+					reinterpret_cast<const int*>(data + bit / CHAR_BIT),
+					_mm256_srli_epi32(offsets, 3), 1);
+				auto values = _mm256_and_si256(_mm256_srlv_epi32(words,
+					_mm256_and_si256(offsets, bit_mask)), value_mask);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(
+					ranges::data(out_buffer) + i), values);
+			}
+		}
+	}
+	if constexpr ((sizeof(T) == sizeof(uint64_t)) &&
+		(endian::native == endian::little))
+	{
+		// Same as above with 64-bit words which hold values up to 57 bits
+		// wide.
+		if (width <= 57)
+		{
+			auto lane_offsets = _mm256_setr_epi64x(0, width, 2 * width,
+				3 * width);
+			auto value_mask = _mm256_set1_epi64x(static_cast<long long>(mask));
+			auto bit_mask = _mm256_set1_epi64x(CHAR_BIT - 1);
+			for (; i + 4 <= out_buffer.size(); i += 4)
+			{
+				auto bit = bit_offset + i * width;
+				auto offsets = _mm256_add_epi64(lane_offsets,
+					_mm256_set1_epi64x(static_cast<long long>(bit % CHAR_BIT)));
+				auto words = _mm256_i64gather_epi64(
+					reinterpret_cast<const long long*>(data + bit / CHAR_BIT),
+					_mm256_srli_epi64(offsets, 3), 1);
+				auto values = _mm256_and_si256(_mm256_srlv_epi64(words,
+					_mm256_and_si256(offsets, bit_mask)), value_mask);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(
+					ranges::data(out_buffer) + i), values);
+			}
+		}
+	}
+#endif
+	for (; i < out_buffer.size(); ++i)
+	{
+		auto bit = bit_offset + i * width;
+		auto shift = static_cast<int>(bit % CHAR_BIT);
+		auto word = LoadLittleEndian64(data + bit / CHAR_BIT) >> shift;
+		if ((shift != 0) && (shift + width > 64))
+		{
+			word |= LoadLittleEndian64(data + bit / CHAR_BIT + 8) <<
+				(64 - shift);
+		}
+		out_buffer[i] = static_cast<T>(word & mask);
+	}
+}
+
+template <unsigned_integral T>
+/*constexpr*/ size_t PackBits(span<const T> in_buffer, int width,
+	span<byte> out_buffer) noexcept
+{
+	auto data = ranges::data(out_buffer);
+	auto mask = GetBitMask(width);
+	uint64_t accumulator = 0;
+	int bit_count = 0;
+	size_t size = 0;
+	for (auto element : in_buffer)
+	{
+		auto value = static_cast<uint64_t>(element) & mask;
+		accumulator |= value << bit_count;
+		bit_count += width;
+		if (bit_count >= 64)
+		{
+			StoreLittleEndian64(accumulator, data + size);
+			size += sizeof(accumulator);
+			bit_count -= 64;
+			// Remaining high bits of the value that didn't fit.
+			accumulator = (bit_count == 0) ? 0 : value >> (width - bit_count);
+		}
+	}
+	for (; bit_count > 0; bit_count -= CHAR_BIT)
+	{
+		data[size++] = byte{static_cast<unsigned char>(accumulator)};
+		accumulator >>= CHAR_BIT;
+	}
+	return size;
+}
+
+constexpr size_t GetPackedSize(size_t count, int width) noexcept
+{
+	return (count * static_cast<size_t>(width) + CHAR_BIT - 1) / CHAR_BIT;
+}
+
+}
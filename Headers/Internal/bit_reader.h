@@ -0,0 +1,78 @@
+/// \file
+/// \brief Internal header file that describes the bit_reader class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <array>
+
+#include "stream_concepts.h"
+#include "bit_packing_utilities.h"
+
+namespace std::io
+{
+
+/// \brief Reads fields of arbitrary bit width from the input stream.
+/// \details Bits are read least significant bit first, starting from the least
+/// significant bit of each byte. Bytes are read from the stream ahead in
+/// blocks, so the stream position after reading is unspecified.
+/// \tparam S Type of the stream to read from.
+
+template <input_stream S>
+class bit_reader final
+{
+public:
+	// Constructor
+	constexpr explicit bit_reader(S& s) noexcept;
+	
+	// Stream
+	constexpr S& get_stream() noexcept;
+	constexpr const S& get_stream() const noexcept;
+	
+	// Reading
+	constexpr uint64_t read_bits(int count);
+	constexpr bool read_bit();
+	constexpr uint64_t peek_bits(int count);
+	constexpr void skip_bits(int count);
+	constexpr void align();
+	
+	template <unsigned_integral T>
+	constexpr void read_packed(span<T> buffer, int width);
+private:
+	/// \brief Size of the buffer of bytes read ahead.
+	static constexpr size_t BufferSize = 4096;
+	
+	/// \brief Amount of consumed bytes kept when the buffer is compacted so
+	/// that bits of the accumulator can be returned to the buffer.
+	static constexpr size_t HistorySize = sizeof(uint64_t);
+	
+	/// \brief Reads bytes to the accumulator so that it has at least 56 bits if
+	/// enough bytes are available.
+	/// \throw std::io::io_error If the stream has thrown.
+	constexpr void Refill();
+	
+	/// \brief Compacts the buffer and reads more bytes from the stream once.
+	/// \throw std::io::io_error If the stream has thrown.
+	constexpr void FillBuffer();
+	
+	/// \brief Checks that the amount of bits is supported.
+	/// \param[in] count Amount of bits to check.
+	/// \param[in] max_count Maximum amount of bits.
+	/// \throw std::io::io_error If amount of bits is out of range.
+	static constexpr void CheckBitCount(int count, int max_count);
+	
+	S& m_stream; ///< Stream to read from.
+	/// \brief Bytes read from the stream followed by the padding needed for
+	/// unpacking.
+	array<byte, BufferSize + Utilities::UnpackBitsPadding> m_buffer{};
+	size_t m_begin = 0; ///< Index of the first unconsumed byte.
+	size_t m_end = 0; ///< Index past the last byte read from the stream.
+	uint64_t m_accumulator = 0; ///< Bits of consumed bytes not yet read.
+	int m_bit_count = 0; ///< Amount of valid bits in the accumulator.
+	bool m_end_of_stream = false; ///< True if the stream has ended.
+};
+
+}
+
+#include "bit_reader.hpp"
@@ -0,0 +1,210 @@
+/// \file
+/// \brief Internal header file that contains implementation of the bit_reader
+/// class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <algorithm>
+
+#include "io_error.h"
+
+namespace std::io
+{
+
+template <input_stream S>
+constexpr bit_reader<S>::bit_reader(S& s) noexcept
+	: m_stream{s}
+{
+}
+
+template <input_stream S>
+constexpr S& bit_reader<S>::get_stream() noexcept
+{
+	return m_stream;
+}
+
+template <input_stream S>
+constexpr const S& bit_reader<S>::get_stream() const noexcept
+{
+	return m_stream;
+}
+
+template <input_stream S>
+constexpr uint64_t bit_reader<S>::read_bits(int count)
+{
+	CheckBitCount(count, 64);
+	if (count > 56)
+	{
+		// The accumulator can't hold that many bits after a refill.
+		auto low = read_bits(32);
+		return low | (read_bits(count - 32) << 32);
+	}
+	auto value = peek_bits(count);
+	m_accumulator >>= count;
+	m_bit_count -= count;
+	return value;
+}
+
+template <input_stream S>
+constexpr bool bit_reader<S>::read_bit()
+{
+	return read_bits(1) != 0;
+}
+
+template <input_stream S>
+constexpr uint64_t bit_reader<S>::peek_bits(int count)
+{
+	CheckBitCount(count, 56);
+	while (m_bit_count < count)
+	{
+		Refill();
+		if ((m_bit_count < count) && (m_begin == m_end) && m_end_of_stream)
+		{
+			throw io_error{"bit_reader: Reached end of stream",
+				io_errc::reached_end_of_file};
+		}
+	}
+	return m_accumulator & Utilities::GetBitMask(count);
+}
+
+template <input_stream S>
+constexpr void bit_reader<S>::skip_bits(int count)
+{
+	if (count < 0)
+	{
+		throw io_error{"skip_bits", io_errc::invalid_argument};
+	}
+	while (count > 0)
+	{
+		auto step = min(count, 56);
+		read_bits(step);
+		count -= step;
+	}
+}
+
+template <input_stream S>
+constexpr void bit_reader<S>::align()
+{
+	// Accumulator always holds the remaining bits of whole bytes.
+	auto count = m_bit_count % CHAR_BIT;
+	m_accumulator >>= count;
+	m_bit_count -= count;
+}
+
+template <input_stream S>
+template <unsigned_integral T>
+constexpr void bit_reader<S>::read_packed(span<T> buffer, int width)
+{
+	CheckBitCount(width, numeric_limits<T>::digits);
+	if (width == 0)
+	{
+		ranges::fill(buffer, T{0});
+		return;
+	}
+	// Return the bits of the accumulator to the buffer and unpack directly
+	// from it.
+	auto bytes = static_cast<size_t>((m_bit_count + CHAR_BIT - 1) / CHAR_BIT);
+	m_begin -= bytes;
+	size_t bit_offset = bytes * CHAR_BIT - m_bit_count;
+	m_accumulator = 0;
+	m_bit_count = 0;
+	while (!buffer.empty())
+	{
+		auto available_bits = (m_end - m_begin) * CHAR_BIT - bit_offset;
+		auto count = min(buffer.size(), available_bits / width);
+		if (count == 0)
+		{
+			if (m_end_of_stream)
+			{
+				throw io_error{"bit_reader: Reached end of stream",
+					io_errc::reached_end_of_file};
+			}
+			FillBuffer();
+			continue;
+		}
+		Utilities::UnpackBits(span<const byte>{m_buffer}.subspan(m_begin),
+			bit_offset, width, buffer.first(count));
+		auto bit = bit_offset + count * width;
+		m_begin += bit / CHAR_BIT;
+		bit_offset = bit % CHAR_BIT;
+		buffer = buffer.subspan(count);
+	}
+	if (bit_offset != 0)
+	{
+		m_accumulator = to_integer<uint64_t>(m_buffer[m_begin]) >> bit_offset;
+		m_bit_count = static_cast<int>(CHAR_BIT - bit_offset);
+		++m_begin;
+	}
+}
+
+template <input_stream S>
+constexpr void bit_reader<S>::Refill()
+{
+	if ((m_end - m_begin < sizeof(uint64_t)) && !m_end_of_stream)
+	{
+		FillBuffer();
+	}
+	if (m_end - m_begin >= sizeof(uint64_t))
+	{
+		// Bits above m_bit_count either are zero or come from the same bytes
+		// that are loaded now, so they can be combined without masking.
+		m_accumulator |= Utilities::LoadLittleEndian64(ranges::data(m_buffer) +
+			m_begin) << m_bit_count;
+		m_begin += static_cast<size_t>(63 - m_bit_count) / CHAR_BIT;
+		m_bit_count |= 56;
+		return;
+	}
+	while ((m_bit_count <= 56) && (m_begin < m_end))
+	{
+		m_accumulator |= to_integer<uint64_t>(m_buffer[m_begin]) <<
+			m_bit_count;
+		m_bit_count += CHAR_BIT;
+		++m_begin;
+	}
+}
+
+template <input_stream S>
+constexpr void bit_reader<S>::FillBuffer()
+{
+	auto keep_from = m_begin - min(m_begin, HistorySize);
+	auto first = ranges::begin(m_buffer);
+	ranges::copy(first + keep_from, first + m_end, first);
+	m_begin -= keep_from;
+	m_end -= keep_from;
+	for (;;)
+	{
+		streamsize bytes_read;
+		try
+		{
+			bytes_read = m_stream.read_some(span<byte>{m_buffer}.subspan(
+				m_end, BufferSize - m_end));
+		}
+		catch (io_error& e)
+		{
+			if (e.code() != io_errc::interrupted)
+			{
+				throw;
+			}
+			continue;
+		}
+		if (bytes_read == 0)
+		{
+			m_end_of_stream = true;
+		}
+		m_end += static_cast<size_t>(bytes_read);
+		return;
+	}
+}
+
+template <input_stream S>
+constexpr void bit_reader<S>::CheckBitCount(int count, int max_count)
+{
+	if ((count < 0) || (count > max_count))
+	{
+		throw io_error{"bit_reader", io_errc::invalid_argument};
+	}
+}
+
+}
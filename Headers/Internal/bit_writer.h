@@ -0,0 +1,65 @@
+/// \file
+/// \brief Internal header file that describes the bit_writer class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <array>
+
+#include "stream_concepts.h"
+#include "bit_packing_utilities.h"
+
+namespace std::io
+{
+
+/// \brief Writes fields of arbitrary bit width to the output stream.
+/// \details Bits are written least significant bit first, starting from the
+/// least significant bit of each byte. Bytes are written to the stream in
+/// blocks and only flush writes the remaining ones.
+/// \tparam S Type of the stream to write to.
+
+template <output_stream S>
+class bit_writer final
+{
+public:
+	// Constructor
+	constexpr explicit bit_writer(S& s) noexcept;
+	
+	// Stream
+	constexpr S& get_stream() noexcept;
+	constexpr const S& get_stream() const noexcept;
+	
+	// Writing
+	constexpr void write_bits(uint64_t value, int count);
+	constexpr void write_bit(bool value);
+	constexpr void align();
+	constexpr void flush();
+	
+	template <unsigned_integral T>
+	constexpr void write_packed(span<const T> buffer, int width);
+private:
+	/// \brief Size of the buffer of bytes written ahead.
+	static constexpr size_t BufferSize = 4096;
+	
+	/// \brief Moves whole bytes from the accumulator to the buffer and writes
+	/// the buffer to the stream when it is full.
+	/// \throw std::io::io_error If the stream has thrown.
+	constexpr void Store();
+	
+	/// \brief Writes the buffer to the stream.
+	/// \throw std::io::io_error If the stream has thrown.
+	constexpr void WriteBuffer();
+	
+	S& m_stream; ///< Stream to write to.
+	/// \brief Bytes not yet written to the stream followed by the room for
+	/// storing the whole accumulator.
+	array<byte, BufferSize + sizeof(uint64_t)> m_buffer{};
+	size_t m_size = 0; ///< Amount of bytes in the buffer.
+	uint64_t m_accumulator = 0; ///< Bits that don't form a whole byte yet.
+	int m_bit_count = 0; ///< Amount of valid bits in the accumulator.
+};
+
+}
+
+#include "bit_writer.hpp"
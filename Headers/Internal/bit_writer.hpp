@@ -0,0 +1,111 @@
+/// \file
+/// \brief Internal header file that contains implementation of the bit_writer
+/// class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include "io_error.h"
+#include "write_raw.h"
+
+namespace std::io
+{
+
+template <output_stream S>
+constexpr bit_writer<S>::bit_writer(S& s) noexcept
+	: m_stream{s}
+{
+}
+
+template <output_stream S>
+constexpr S& bit_writer<S>::get_stream() noexcept
+{
+	return m_stream;
+}
+
+template <output_stream S>
+constexpr const S& bit_writer<S>::get_stream() const noexcept
+{
+	return m_stream;
+}
+
+template <output_stream S>
+constexpr void bit_writer<S>::write_bits(uint64_t value, int count)
+{
+	if ((count < 0) || (count > 64))
+	{
+		throw io_error{"bit_writer", io_errc::invalid_argument};
+	}
+	if (count > 56)
+	{
+		// The accumulator has room for at least 57 bits.
+		write_bits(value, 32);
+		write_bits(value >> 32, count - 32);
+		return;
+	}
+	m_accumulator |= (value & Utilities::GetBitMask(count)) << m_bit_count;
+	m_bit_count += count;
+	Store();
+}
+
+template <output_stream S>
+constexpr void bit_writer<S>::write_bit(bool value)
+{
+	write_bits(value ? 1 : 0, 1);
+}
+
+template <output_stream S>
+constexpr void bit_writer<S>::align()
+{
+	// Padding bits are already zero.
+	m_bit_count = (m_bit_count + CHAR_BIT - 1) / CHAR_BIT * CHAR_BIT;
+	Store();
+}
+
+template <output_stream S>
+constexpr void bit_writer<S>::flush()
+{
+	align();
+	WriteBuffer();
+}
+
+template <output_stream S>
+template <unsigned_integral T>
+constexpr void bit_writer<S>::write_packed(span<const T> buffer, int width)
+{
+	if ((width < 0) || (width > numeric_limits<T>::digits))
+	{
+		throw io_error{"bit_writer", io_errc::invalid_argument};
+	}
+	for (auto value : buffer)
+	{
+		write_bits(value, width);
+	}
+}
+
+template <output_stream S>
+constexpr void bit_writer<S>::Store()
+{
+	// Whole accumulator is stored and only the complete bytes are kept so
+	// that this doesn't branch on the amount of bits.
+	Utilities::StoreLittleEndian64(m_accumulator, ranges::data(m_buffer) +
+		m_size);
+	auto bytes = m_bit_count / CHAR_BIT;
+	m_size += static_cast<size_t>(bytes);
+	m_accumulator >>= bytes * CHAR_BIT;
+	m_bit_count -= bytes * CHAR_BIT;
+	if (m_size >= BufferSize)
+	{
+		WriteBuffer();
+	}
+}
+
+template <output_stream S>
+constexpr void bit_writer<S>::WriteBuffer()
+{
+	write_raw(span<const byte>{m_buffer}.first(m_size), m_stream);
+	m_size = 0;
+}
+
+}
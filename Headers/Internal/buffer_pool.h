@@ -0,0 +1,60 @@
+/// \file
+/// \brief Internal header file that describes the buffer_pool class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace std::io
+{
+
+/// \brief Thread-safe pool of byte vectors grouped by capacity.
+/// \details Capacities are rounded up to the power of 2 so that each size class
+/// holds buffers of the same capacity. Buffers that are smaller than
+/// min_capacity, larger than max_capacity or don't fit into the full size
+/// class are freed instead of being kept.
+
+class buffer_pool final
+{
+public:
+	/// \brief Smallest capacity of the pooled buffer.
+	static constexpr size_t min_capacity = size_t{1} << 8;
+	/// \brief Largest capacity of the pooled buffer.
+	static constexpr size_t max_capacity = size_t{1} << 24;
+	
+	// Construct/copy/destroy
+	explicit buffer_pool(size_t max_buffers_per_class = 16);
+	buffer_pool(const buffer_pool&) = delete;
+	buffer_pool& operator=(const buffer_pool&) = delete;
+	
+	// Buffers
+	vector<byte> acquire(size_t capacity = min_capacity);
+	void release(vector<byte>&& buffer) noexcept;
+	
+	// Free buffers
+	size_t get_free_count() const;
+	void trim() noexcept;
+	
+	// Shared pools
+	static buffer_pool& get_global() noexcept;
+	static buffer_pool& get_thread_local() noexcept;
+private:
+	/// \brief Amount of size classes.
+	static constexpr size_t ClassCount = 17;
+	
+	/// \brief Returns the index of the size class of the given capacity.
+	/// \param[in] capacity Capacity to find the class of.
+	/// \return Index of the smallest class that holds the given capacity.
+	static size_t GetClassIndex(size_t capacity) noexcept;
+	
+	size_t m_max_buffers_per_class; ///< Maximum amount of buffers per class.
+	mutable mutex m_mutex; ///< Mutex that guards the size classes.
+	array<vector<vector<byte>>, ClassCount> m_classes; ///< Free buffers.
+};
+
+}
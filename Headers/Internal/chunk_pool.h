@@ -0,0 +1,45 @@
+/// \file
+/// \brief Internal header file that describes the chunk_pool class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace std::io
+{
+
+/// \brief Pool of memory chunks of the same size.
+/// \details Chunks returned to the pool are kept and handed out again instead
+/// of being freed. The pool is not thread-safe and must outlive every stream
+/// that uses it.
+
+class chunk_pool final
+{
+public:
+	/// \brief Size of the chunks used when no size is given.
+	static constexpr size_t default_chunk_size = 65536;
+	
+	// Construct/copy/destroy
+	explicit chunk_pool(size_t chunk_size = default_chunk_size);
+	chunk_pool(const chunk_pool&) = delete;
+	chunk_pool& operator=(const chunk_pool&) = delete;
+	
+	// Chunks
+	size_t get_chunk_size() const noexcept;
+	unique_ptr<byte[]> acquire();
+	void release(unique_ptr<byte[]> chunk) noexcept;
+	
+	// Free chunks
+	size_t get_free_count() const noexcept;
+	void reserve(size_t count);
+	void trim() noexcept;
+private:
+	size_t m_chunk_size; ///< Size of each chunk in bytes.
+	vector<unique_ptr<byte[]>> m_free_chunks; ///< Chunks ready to be reused.
+};
+
+}
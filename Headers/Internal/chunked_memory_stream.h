@@ -0,0 +1,73 @@
+/// \file
+/// \brief Internal header file that describes the chunked_memory_stream
+/// class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <span>
+
+#include "position_helper.h"
+#include "chunk_pool.h"
+
+namespace std::io
+{
+
+/// \brief Seekable memory stream that stores bytes in chunks of fixed size.
+/// \details Growing the stream adds chunks and never moves bytes that were
+/// already written, so appending takes constant time and peak memory stays
+/// close to the size of the stream. Chunks are taken from the given pool or
+/// allocated directly and are returned when the stream is reset or
+/// destroyed.
+
+class chunked_memory_stream final :
+	public PositionHelper<chunked_memory_stream, streamoff>
+{
+public:
+	// Construct/copy/destroy
+	explicit chunked_memory_stream(
+		size_t chunk_size = chunk_pool::default_chunk_size);
+	explicit chunked_memory_stream(chunk_pool& pool) noexcept;
+	chunked_memory_stream(const chunked_memory_stream&) = delete;
+	chunked_memory_stream(chunked_memory_stream&& other) noexcept;
+	~chunked_memory_stream();
+	chunked_memory_stream& operator=(const chunked_memory_stream&) = delete;
+	chunked_memory_stream& operator=(chunked_memory_stream&& other) noexcept;
+	
+	// Reading
+	streamsize read_some(span<byte> buffer);
+	
+	// Writing
+	streamsize write_some(span<const byte> buffer);
+	
+	// Buffer management
+	size_t get_size() const noexcept;
+	size_t get_chunk_size() const noexcept;
+	vector<span<const byte>> get_chunks() const;
+	void reset_buffer() noexcept;
+private:
+	/// \brief Adds chunks until the stream can hold the given amount of bytes.
+	/// \param[in] size Amount of bytes to hold.
+	/// \throw std::bad_alloc If there was not enough memory.
+	void AddChunks(size_t size);
+	
+	/// \brief Calls the given function for each part of the chunks that holds
+	/// the given range of bytes.
+	/// \param[in] first Index of the first byte of the range.
+	/// \param[in] last Index past the last byte of the range.
+	/// \param[in] f Function that takes the part of the chunk and the offset of
+	/// that part from the start of the range.
+	template <typename F>
+	void ForEachChunk(size_t first, size_t last, F f) const;
+	
+	/// \brief Returns all chunks to the pool or frees them.
+	void ReleaseChunks() noexcept;
+	
+	chunk_pool* m_pool; ///< Pool to take chunks from or nullptr.
+	size_t m_chunk_size; ///< Size of each chunk in bytes.
+	vector<unique_ptr<byte[]>> m_chunks; ///< Chunks in order of bytes.
+	size_t m_size; ///< Amount of bytes in the stream.
+};
+
+}
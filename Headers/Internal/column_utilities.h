@@ -0,0 +1,27 @@
+/// \file
+/// \brief Internal header file that describes the utility functions for
+/// transposing fixed-layout records into columns.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <climits>
+
+namespace std::io::Utilities
+{
+
+/// \brief Decodes one field of each record to the column.
+/// \details 2, 4 and 8 byte fields are gathered 8, 8 and 4 at a time with
+/// AVX2 when it is available.
+/// \tparam Size Size of the record in bytes.
+/// \tparam Field Specialization of record_field to decode.
+/// \param[in] records Bytes of column.size() consecutive records.
+/// \param[out] column Buffer to decode to.
+template <size_t Size, typename Field>
+/*constexpr*/ void ExtractColumn(span<const byte> records,
+	span<typename Field::value_type> column);
+
+}
+
+#include "column_utilities.hpp"
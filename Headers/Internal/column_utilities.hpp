@@ -0,0 +1,121 @@
+/// \file
+/// \brief Internal header file that contains implementation of the utility
+/// functions for transposing fixed-layout records into columns.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace std::io::Utilities
+{
+
+#if defined(__AVX2__)
+/// \brief Builds the mask for _mm256_shuffle_epi8 that takes the field bytes
+/// from each gathered word and packs them to the low bytes of each 128-bit
+/// lane.
+/// \param[in] size Size of the field in bytes.
+/// \param[in] first Index of the first field byte in the gathered word.
+/// \param[in] word_size Size of the gathered word in bytes.
+/// \param[in] swap True if bytes of each field need to be reversed.
+/// \return Shuffle mask.
+inline __m256i GetColumnShuffleMask(int size, int first, int word_size,
+	bool swap) noexcept
+{
+	alignas(32) char mask[32];
+	for (int lane = 0; lane < 2; ++lane)
+	{
+		auto words = 16 / word_size;
+		for (int i = 0; i < 16; ++i)
+		{
+			auto word = i / size;
+			auto index = swap ? size - 1 - i % size : i % size;
+			mask[16 * lane + i] = (word < words) ?
+				static_cast<char>(word * word_size + first + index) : char{-1};
+		}
+	}
+	return _mm256_load_si256(reinterpret_cast<const __m256i*>(mask));
+}
+#endif
+
+template <size_t Size, typename Field>
+/*constexpr*/ void ExtractColumn(span<const byte> records,
+	span<typename Field::value_type> column)
+{
+	size_t i = 0;
+#if defined(__AVX2__)
+	using T = typename Field::value_type;
+	if constexpr ((endian::native == endian::little) &&
+		((sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8)) &&
+		(Size >= 4) && (Size <= INT_MAX / 8) && !same_as<T, bool>)
+	{
+		constexpr bool swap = Field::endianness != endian::native;
+		constexpr int stride = static_cast<int>(Size);
+		auto data = ranges::data(records);
+		auto out = reinterpret_cast<byte*>(ranges::data(column));
+		if constexpr (sizeof(T) == 2)
+		{
+			// Gather 4 bytes so that the load stays within the record.
+			constexpr size_t load_offset = min(Field::offset, Size - 4);
+			auto indices = _mm256_setr_epi32(0, stride, 2 * stride,
+				3 * stride, 4 * stride, 5 * stride, 6 * stride, 7 * stride);
+			auto mask = GetColumnShuffleMask(2,
+				static_cast<int>(Field::offset - load_offset), 4, swap);
+			for (; i + 8 <= column.size(); i += 8)
+			{
+				auto words = _mm256_i32gather_epi32(reinterpret_cast<const int*>(
+					data + i * Size + load_offset), indices, 1);
+				auto values = _mm256_permute4x64_epi64(
+					_mm256_shuffle_epi8(words, mask), 0x08);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i),
+					_mm256_castsi256_si128(values));
+			}
+		}
+		else if constexpr (sizeof(T) == 4)
+		{
+			auto indices = _mm256_setr_epi32(0, stride, 2 * stride,
+				3 * stride, 4 * stride, 5 * stride, 6 * stride, 7 * stride);
+			[[maybe_unused]] auto mask = GetColumnShuffleMask(4, 0, 4, true);
+			for (; i + 8 <= column.size(); i += 8)
+			{
+				auto values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(
+					data + i * Size + Field::offset), indices, 1);
+				if constexpr (swap)
+				{
+					values = _mm256_shuffle_epi8(values, mask);
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4 * i),
+					values);
+			}
+		}
+		else
+		{
+			auto indices = _mm_setr_epi32(0, stride, 2 * stride, 3 * stride);
+			[[maybe_unused]] auto mask = GetColumnShuffleMask(8, 0, 8, true);
+			for (; i + 4 <= column.size(); i += 4)
+			{
+				auto values = _mm256_i32gather_epi64(
+					reinterpret_cast<const long long*>(data + i * Size +
+					Field::offset), indices, 1);
+				if constexpr (swap)
+				{
+					values = _mm256_shuffle_epi8(values, mask);
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8 * i),
+					values);
+			}
+		}
+	}
+#endif
+	for (; i < column.size(); ++i)
+	{
+		column[i] = Field::decode(records.subspan(i * Size, Size));
+	}
+}
+
+}
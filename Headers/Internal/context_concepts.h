@@ -6,6 +6,7 @@
 #pragma once
 
 #include "stream_concepts.h"
+#include "read_limits.h"
 
 namespace std::io
 {
@@ -29,4 +30,10 @@ concept input_context = context<C> && input_stream<typename C::stream_type>;
 template <typename C>
 concept output_context = context<C> && output_stream<typename C::stream_type>;
 
+template <typename C>
+concept limited_context = context<C> && requires(C ctx)
+	{
+		{ctx.get_limits()} -> same_as<read_limits&>;
+	};
+
 }
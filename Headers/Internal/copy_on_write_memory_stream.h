@@ -0,0 +1,71 @@
+/// \file
+/// \brief Internal header file that describes the copy_on_write_memory_stream
+/// class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "position_helper.h"
+
+namespace std::io
+{
+
+/// \brief Seekable memory stream that stores bytes in chunks of fixed size and
+/// shares them between copies.
+/// \details Copying the stream or taking its snapshot copies only the list of
+/// chunks. Writing to the chunk that is shared with another copy duplicates
+/// that chunk first, so the other copies are not affected. Snapshots may be
+/// read from another thread while the original stream is being written.
+
+class copy_on_write_memory_stream final :
+	public PositionHelper<copy_on_write_memory_stream, streamoff>
+{
+public:
+	/// \brief Size of the chunks used when no size is given.
+	static constexpr size_t default_chunk_size = 4096;
+	
+	// Construct/copy/destroy
+	explicit copy_on_write_memory_stream(
+		size_t chunk_size = default_chunk_size);
+	
+	// Reading
+	streamsize read_some(span<byte> buffer);
+	
+	// Writing
+	streamsize write_some(span<const byte> buffer);
+	
+	// Buffer management
+	size_t get_size() const noexcept;
+	size_t get_chunk_size() const noexcept;
+	vector<span<const byte>> get_chunks() const;
+	copy_on_write_memory_stream snapshot() const;
+	void reset_buffer() noexcept;
+private:
+	/// \brief Calls the given function for each part of the chunks that holds
+	/// the given range of bytes.
+	/// \param[in] first Index of the first byte of the range.
+	/// \param[in] last Index past the last byte of the range.
+	/// \param[in] f Function that takes the index of the chunk, the offset of
+	/// the part in the chunk, the size of the part and the offset of the part
+	/// from the start of the range.
+	template <typename F>
+	void ForEachChunk(size_t first, size_t last, F f) const;
+	
+	/// \brief Returns the chunk that can be modified, duplicating it if it is
+	/// shared.
+	/// \param[in] index Index of the chunk.
+	/// \return Pointer to the bytes of the chunk.
+	/// \throw std::bad_alloc If there was not enough memory.
+	byte* GetWritableChunk(size_t index);
+	
+	size_t m_chunk_size; ///< Size of each chunk in bytes.
+	vector<shared_ptr<byte[]>> m_chunks; ///< Chunks in order of bytes.
+	size_t m_size; ///< Amount of bytes in the stream.
+};
+
+}
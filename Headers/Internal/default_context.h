@@ -8,18 +8,24 @@
 
 #include "stream_concepts.h"
 #include "format.h"
+#include "read_limits.h"
+#include "encoding_policy.h"
 
 namespace std::io
 {
 
-template <stream S>
+template <stream S, typename Policy = format_encoding_policy>
 class default_context final
 {
 public:
 	using stream_type = S;
+	using encoding_policy = Policy;
 	
-	// Constructor
-	constexpr default_context(S& s, format f = {}) noexcept;
+	// Constructors
+	constexpr default_context(S& s, format f = {}, read_limits limits = {})
+		noexcept;
+	constexpr default_context(S& s, Policy policy, format f = {},
+		read_limits limits = {}) noexcept;
 	
 	// Stream
 	constexpr S& get_stream() noexcept;
@@ -28,9 +34,15 @@ public:
 	// Format
 	constexpr format get_format() const noexcept;
 	constexpr void set_format(format f) noexcept;
+	
+	// Limits
+	constexpr read_limits& get_limits() noexcept;
+	constexpr const read_limits& get_limits() const noexcept;
+	constexpr void set_limits(read_limits limits) noexcept;
 private:
 	S& m_stream;
 	format m_format;
+	read_limits m_limits;
 };
 
 }
@@ -9,35 +9,66 @@
 namespace std::io
 {
 
-template <stream S>
-constexpr default_context<S>::default_context(S& s, format f) noexcept
+template <stream S, typename Policy>
+constexpr default_context<S, Policy>::default_context(S& s, format f,
+	read_limits limits) noexcept
 	: m_stream{s},
-	m_format{f}
+	m_format{f},
+	m_limits{limits}
 {
 }
 
-template <stream S>
-constexpr S& default_context<S>::get_stream() noexcept
+template <stream S, typename Policy>
+constexpr default_context<S, Policy>::default_context(S& s, Policy,
+	format f, read_limits limits) noexcept
+	: m_stream{s},
+	m_format{f},
+	m_limits{limits}
+{
+}
+
+template <stream S, typename Policy>
+constexpr S& default_context<S, Policy>::get_stream() noexcept
 {
 	return m_stream;
 }
 
-template <stream S>
-constexpr const S& default_context<S>::get_stream() const noexcept
+template <stream S, typename Policy>
+constexpr const S& default_context<S, Policy>::get_stream() const noexcept
 {
 	return m_stream;
 }
 
-template <stream S>
-constexpr format default_context<S>::get_format() const noexcept
+template <stream S, typename Policy>
+constexpr format default_context<S, Policy>::get_format() const noexcept
 {
 	return m_format;
 }
 
-template <stream S>
-constexpr void default_context<S>::set_format(format f) noexcept
+template <stream S, typename Policy>
+constexpr void default_context<S, Policy>::set_format(format f) noexcept
 {
 	m_format = f;
 }
 
+template <stream S, typename Policy>
+constexpr read_limits& default_context<S, Policy>::get_limits() noexcept
+{
+	return m_limits;
+}
+
+template <stream S, typename Policy>
+constexpr const read_limits& default_context<S, Policy>::get_limits() const
+	noexcept
+{
+	return m_limits;
+}
+
+template <stream S, typename Policy>
+constexpr void default_context<S, Policy>::set_limits(read_limits limits)
+	noexcept
+{
+	m_limits = limits;
+}
+
 }
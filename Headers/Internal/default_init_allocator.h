@@ -0,0 +1,49 @@
+/// \file
+/// \brief Internal header file that describes the default_init_allocator
+/// class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <memory>
+
+namespace std::io
+{
+
+/// \brief Allocator adaptor that default-initializes elements constructed
+/// without arguments.
+/// \details Resizing containers of bytes that use this allocator leaves new
+/// bytes uninitialized instead of zeroing them, which makes it suitable for
+/// buffers of memory streams that are about to be overwritten.
+/// \tparam T Type of the elements.
+/// \tparam Allocator Type of the underlying allocator.
+
+template <typename T, typename Allocator = allocator<T>>
+class default_init_allocator : public Allocator
+{
+public:
+	template <typename U>
+	struct rebind
+	{
+		using other = default_init_allocator<U, typename allocator_traits<
+			Allocator>::template rebind_alloc<U>>;
+	};
+	
+	// Constructors
+	using Allocator::Allocator;
+	constexpr default_init_allocator() = default;
+	template <typename U, typename OtherAllocator>
+	constexpr default_init_allocator(
+		const default_init_allocator<U, OtherAllocator>& other) noexcept;
+	
+	// Construction
+	template <typename U>
+	void construct(U* p) noexcept(is_nothrow_default_constructible_v<U>);
+	template <typename U, typename... Args>
+	void construct(U* p, Args&&... args);
+};
+
+}
+
+#include "default_init_allocator.hpp"
@@ -0,0 +1,38 @@
+/// \file
+/// \brief Internal header file that contains implementation of the
+/// default_init_allocator class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <new>
+
+namespace std::io
+{
+
+template <typename T, typename Allocator>
+template <typename U, typename OtherAllocator>
+constexpr default_init_allocator<T, Allocator>::default_init_allocator(
+	const default_init_allocator<U, OtherAllocator>& other) noexcept
+	: Allocator{static_cast<const OtherAllocator&>(other)}
+{
+}
+
+template <typename T, typename Allocator>
+template <typename U>
+void default_init_allocator<T, Allocator>::construct(U* p)
+	noexcept(is_nothrow_default_constructible_v<U>)
+{
+	::new(static_cast<void*>(p)) U;
+}
+
+template <typename T, typename Allocator>
+template <typename U, typename... Args>
+void default_init_allocator<T, Allocator>::construct(U* p, Args&&... args)
+{
+	allocator_traits<Allocator>::construct(static_cast<Allocator&>(*this), p,
+		forward<Args>(args)...);
+}
+
+}
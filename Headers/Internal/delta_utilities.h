@@ -0,0 +1,46 @@
+/// \file
+/// \brief Internal header file that describes the utility functions for delta
+/// bit-packed integer encoding.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <cstdint>
+
+#include "varint_utilities.h"
+#include "bit_packing_utilities.h"
+
+namespace std::io::Utilities
+{
+
+/// \brief Maximum amount of values in one block of delta bit-packed encoding.
+inline constexpr size_t DeltaBlockSize = 128;
+
+/// \brief Maximum amount of bytes in the encoding of one block.
+inline constexpr size_t MaxDeltaBlockSize = MaxLEB128Size<uint64_t> + 1 +
+	DeltaBlockSize * sizeof(uint64_t);
+
+/// \brief Encodes up to DeltaBlockSize values as one block.
+/// \details Block consists of the minimum difference between consecutive
+/// values as unsigned LEB128, 1 byte of bit width and the differences minus
+/// minimum packed to that width. Differences are computed modulo 2^64 so any
+/// values can be encoded but only non-decreasing ones are compact.
+/// \param[in] values Values to encode.
+/// \param[in] previous Value preceding the first value of the block.
+/// \param[out] out_buffer Buffer to write to. Must be at least
+/// MaxDeltaBlockSize bytes.
+/// \return Amount of bytes written.
+/*constexpr*/ size_t EncodeDeltaBlock(span<const uint64_t> values,
+	uint64_t previous, span<byte> out_buffer) noexcept;
+
+/// \brief Turns unpacked differences of one block back into values.
+/// \param[in,out] values Differences minus minimum to turn into values.
+/// \param[in] minimum Minimum difference of the block.
+/// \param[in] previous Value preceding the first value of the block.
+/*constexpr*/ void DecodeDeltas(span<uint64_t> values, uint64_t minimum,
+	uint64_t previous) noexcept;
+
+}
+
+#include "delta_utilities.hpp"
@@ -0,0 +1,77 @@
+/// \file
+/// \brief Internal header file that contains implementation of the utility
+/// functions for delta bit-packed integer encoding.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace std::io::Utilities
+{
+
+/*constexpr*/ inline size_t EncodeDeltaBlock(span<const uint64_t> values,
+	uint64_t previous, span<byte> out_buffer) noexcept
+{
+	array<uint64_t, DeltaBlockSize> deltas;
+	auto count = values.size();
+	auto minimum = ~uint64_t{0};
+	for (size_t i = 0; i < count; ++i)
+	{
+		deltas[i] = values[i] - previous;
+		previous = values[i];
+		minimum = min(minimum, deltas[i]);
+	}
+	uint64_t bits = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		deltas[i] -= minimum;
+		bits |= deltas[i];
+	}
+	auto width = static_cast<int>(bit_width(bits));
+	auto size = EncodeLEB128(minimum, out_buffer);
+	out_buffer[size++] = byte{static_cast<unsigned char>(width)};
+	size += PackBits(span<const uint64_t>{deltas}.first(count), width,
+		out_buffer.subspan(size));
+	return size;
+}
+
+/*constexpr*/ inline void DecodeDeltas(span<uint64_t> values, uint64_t minimum,
+	uint64_t previous) noexcept
+{
+	size_t i = 0;
+#if defined(__AVX2__)
+	// Prefix sum of 4 lanes in 2 steps, then add the last value of the
+	// previous group.
+	auto minimums = _mm256_set1_epi64x(static_cast<long long>(minimum));
+	auto carry = _mm256_set1_epi64x(static_cast<long long>(previous));
+	auto zero = _mm256_setzero_si256();
+	for (; i + 4 <= values.size(); i += 4)
+	{
+		auto address = reinterpret_cast<__m256i*>(values.data() + i);
+		auto sums = _mm256_add_epi64(_mm256_loadu_si256(address), minimums);
+		sums = _mm256_add_epi64(sums, _mm256_blend_epi32(
+			_mm256_permute4x64_epi64(sums, 0x90), zero, 0x03));
+		sums = _mm256_add_epi64(sums, _mm256_blend_epi32(
+			_mm256_permute4x64_epi64(sums, 0x40), zero, 0x0F));
+		sums = _mm256_add_epi64(sums, carry);
+		_mm256_storeu_si256(address, sums);
+		carry = _mm256_permute4x64_epi64(sums, 0xFF);
+	}
+	previous = static_cast<uint64_t>(_mm256_extract_epi64(carry, 0));
+#endif
+	for (auto& value : values.subspan(i))
+	{
+		previous += value + minimum;
+		value = previous;
+	}
+}
+
+}
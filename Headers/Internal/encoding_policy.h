@@ -0,0 +1,161 @@
+/// \file
+/// \brief Internal header file that describes encoding policies.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <cstddef>
+
+#include "format.h"
+#include "context_concepts.h"
+#include "aggregate_utilities.h"
+
+namespace std::io
+{
+
+/// \brief Encoding of strings.
+enum class string_encoding
+{
+	length_prefixed,
+	null_terminated
+};
+
+/// \brief Encoding policy that leaves every decision to the format of the
+/// context.
+/// \details Encoding policy is a class that may have any of the following
+/// static members. Missing members are taken from the format of the context
+/// or from the defaults. Because members are constants, they are resolved
+/// when serializers are instantiated and cost nothing at runtime.
+/// - template <typename T> static constexpr integer_format integer_format_for
+///   - integer format of integers and enumerations of type T.
+/// - static constexpr length_prefix_width length_width - width of lengths of
+///   containers and indices of variants.
+/// - template <typename CharT> static constexpr string_encoding
+///   string_encoding_for - encoding of strings of CharT, length_prefixed by
+///   default.
+/// - template <typename T> static constexpr size_t alignment_for - alignment
+///   of objects of type T relative to the stream position, 1 by default.
+///   Zero bytes are written before objects to reach the alignment and are
+///   skipped when reading. Streams must be seekable to use alignment.
+
+struct format_encoding_policy final
+{
+};
+
+/// \brief Encoding policy for compact encoding suitable for networks.
+/// \details All integers are written as LEB128 and strings are null
+/// terminated.
+
+struct compact_encoding_policy final
+{
+	template <typename T>
+	static constexpr integer_format integer_format_for = integer_format::leb128;
+	
+	template <typename CharT>
+	static constexpr string_encoding string_encoding_for =
+		string_encoding::null_terminated;
+};
+
+/// \brief Encoding policy for encoding suitable for memory mapping.
+/// \details Integers are fixed-width, lengths are 8 bytes and every object is
+/// aligned to its natural alignment.
+
+struct aligned_encoding_policy final
+{
+	template <typename T>
+	static constexpr integer_format integer_format_for = integer_format::fixed;
+	
+	static constexpr length_prefix_width length_width =
+		length_prefix_width::eight_bytes;
+	
+	template <typename T>
+	static constexpr size_t alignment_for = alignof(T);
+};
+
+namespace Utilities
+{
+
+/// \brief Provides the encoding policy of the context.
+/// \tparam C Type of the context.
+template <typename C>
+struct EncodingPolicyOf
+{
+	using type = format_encoding_policy;
+};
+
+template <typename C>
+requires requires { typename C::encoding_policy; }
+struct EncodingPolicyOf<C>
+{
+	using type = typename C::encoding_policy;
+};
+
+/// \brief Encoding policy of the context.
+template <typename C>
+using EncodingPolicy = typename EncodingPolicyOf<remove_cvref_t<C>>::type;
+
+/// \brief Returns the integer format of the given type.
+/// \tparam T Type of the integer or enumeration.
+/// \param[in] ctx Context to check.
+/// \return Integer format.
+template <typename T, typename C>
+constexpr integer_format GetIntegerFormat(const C& ctx) noexcept;
+
+/// \brief Returns the width of the length prefix.
+/// \param[in] ctx Context to check.
+/// \return Width of the length prefix.
+template <typename C>
+constexpr length_prefix_width GetLengthPrefixWidth(const C& ctx) noexcept;
+
+/// \brief Returns the encoding of the strings of the given character type.
+/// \tparam CharT Type of the characters.
+/// \tparam C Type of the context.
+/// \return String encoding.
+template <typename CharT, typename C>
+consteval string_encoding GetStringEncoding() noexcept;
+
+/// \brief Returns the alignment of the objects of the given type.
+/// \tparam T Type of the objects.
+/// \tparam C Type of the context.
+/// \return Alignment in bytes.
+template <typename T, typename C>
+consteval size_t GetAlignment() noexcept;
+
+/// \brief Checks that the policy of the context keeps integers of the given
+/// type fixed-width.
+/// \tparam T Type to check. Aggregates are checked field by field.
+/// \tparam C Type of the context.
+/// \return True if the policy doesn't make integers variable-length.
+template <typename T, typename C>
+consteval bool KeepsFixedIntegers() noexcept;
+
+/// \brief Checks if the object representation of the given type is the same
+/// as its representation in the encoding of the context.
+/// \tparam T Type to check.
+/// \param[in] ctx Context to check.
+/// \return True if objects can be transferred as raw bytes.
+template <bitwise_serializable T, typename C>
+constexpr bool IsNativeRepresentation(const C& ctx) noexcept;
+
+/// \brief Writes zero bytes until the stream position is aligned for the
+/// objects of the given type.
+/// \tparam T Type of the objects.
+/// \param[in,out] ctx Context to write to.
+/// \throw std::io::io_error If writing has failed.
+template <typename T>
+constexpr void WritePadding(output_context auto& ctx);
+
+/// \brief Skips bytes until the stream position is aligned for the objects
+/// of the given type.
+/// \tparam T Type of the objects.
+/// \param[in,out] ctx Context to read from.
+/// \throw std::io::io_error If reading has failed.
+template <typename T>
+constexpr void SkipPadding(input_context auto& ctx);
+
+}
+
+}
+
+#include "encoding_policy.hpp"
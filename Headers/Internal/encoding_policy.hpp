@@ -0,0 +1,138 @@
+/// \file
+/// \brief Internal header file that contains implementation of the utility
+/// functions for encoding policies.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include "alignment.h"
+
+namespace std::io::Utilities
+{
+
+template <typename T, typename C>
+constexpr integer_format GetIntegerFormat(const C& ctx) noexcept
+{
+	using Policy = EncodingPolicy<C>;
+	if constexpr (requires { Policy::template integer_format_for<T>; })
+	{
+		return Policy::template integer_format_for<T>;
+	}
+	else
+	{
+		return ctx.get_format().get_integer_format();
+	}
+}
+
+template <typename C>
+constexpr length_prefix_width GetLengthPrefixWidth(const C& ctx) noexcept
+{
+	using Policy = EncodingPolicy<C>;
+	if constexpr (requires { Policy::length_width; })
+	{
+		return Policy::length_width;
+	}
+	else
+	{
+		return ctx.get_format().get_length_prefix_width();
+	}
+}
+
+template <typename CharT, typename C>
+consteval string_encoding GetStringEncoding() noexcept
+{
+	using Policy = EncodingPolicy<C>;
+	if constexpr (requires { Policy::template string_encoding_for<CharT>; })
+	{
+		return Policy::template string_encoding_for<CharT>;
+	}
+	else
+	{
+		return string_encoding::length_prefixed;
+	}
+}
+
+template <typename T, typename C>
+consteval size_t GetAlignment() noexcept
+{
+	using Policy = EncodingPolicy<C>;
+	if constexpr (requires { Policy::template alignment_for<T>; })
+	{
+		return Policy::template alignment_for<T>;
+	}
+	else
+	{
+		return 1;
+	}
+}
+
+template <typename T, typename C>
+consteval bool KeepsFixedIntegers() noexcept
+{
+	using Policy = EncodingPolicy<C>;
+	if constexpr (!requires { Policy::template integer_format_for<int>; })
+	{
+		return true;
+	}
+	else if constexpr ((integral<T> || is_enum_v<T>) && (sizeof(T) > 1))
+	{
+		return Policy::template integer_format_for<T> == integer_format::fixed;
+	}
+	else if constexpr (reflectable_aggregate<T>)
+	{
+		using Fields = decltype(TieFields(declval<T&>()));
+		return []<size_t... I>(index_sequence<I...>)
+		{
+			return (KeepsFixedIntegers<remove_reference_t<
+				tuple_element_t<I, Fields>>, C>() && ...);
+		}(make_index_sequence<tuple_size_v<Fields>>{});
+	}
+	else
+	{
+		return true;
+	}
+}
+
+template <bitwise_serializable T, typename C>
+constexpr bool IsNativeRepresentation(const C& ctx) noexcept
+{
+	auto f = ctx.get_format();
+	if constexpr (requires
+		{
+			EncodingPolicy<C>::template integer_format_for<int>;
+		})
+	{
+		f.set_integer_format(KeepsFixedIntegers<T, C>() ?
+			integer_format::fixed : integer_format::leb128);
+	}
+	return IsNativeRepresentation<T>(f);
+}
+
+template <typename T>
+constexpr void WritePadding(output_context auto& ctx)
+{
+	using C = remove_cvref_t<decltype(ctx)>;
+	constexpr auto alignment = GetAlignment<T, C>();
+	if constexpr (alignment > 1)
+	{
+		static_assert(seekable_stream<typename C::stream_type>,
+			"Alignment requires seekable stream.");
+		PadToAlignment(alignment, ctx.get_stream());
+	}
+}
+
+template <typename T>
+constexpr void SkipPadding(input_context auto& ctx)
+{
+	using C = remove_cvref_t<decltype(ctx)>;
+	constexpr auto alignment = GetAlignment<T, C>();
+	if constexpr (alignment > 1)
+	{
+		static_assert(seekable_stream<typename C::stream_type>,
+			"Alignment requires seekable stream.");
+		SkipToAlignment(alignment, ctx.get_stream());
+	}
+}
+
+}
@@ -0,0 +1,110 @@
+/// \file
+/// \brief Internal header file that describes the utility functions for
+/// converting between native floating point types and non-native floating
+/// point formats.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <climits>
+#include <cstdint>
+
+namespace std::io::Utilities
+{
+
+/// \brief Floating point value decomposed into parts that don't depend on the
+/// format.
+/// \details Finite nonzero value is significand * 2^(exponent - 63).
+
+struct UnpackedFloat
+{
+	bool negative = false; ///< Sign of the value.
+	bool nan = false; ///< True if the value is NaN.
+	bool infinity = false; ///< True if the value is infinity.
+	int exponent = 0; ///< Exponent of the most significant significand bit.
+	uint64_t significand = 0; ///< Significand with bit 63 set or 0 for zero.
+	bool sticky = false; ///< True if nonzero bits were dropped from the
+		///< significand.
+};
+
+/// \brief Checks if the given floating point format is converted via
+/// UnpackedFloat.
+/// \param[in] float_format Format to check.
+/// \return True if format is ibm_hexadecimal, vax, binary128 or x87_extended.
+constexpr bool IsForeignFloatFormat(floating_point_format float_format)
+	noexcept;
+
+/// \brief Returns the amount of bytes the value of the given type occupies in
+/// the given foreign format.
+/// \tparam T Type of the value.
+/// \param[in] float_format Foreign format.
+/// \return Amount of bytes.
+template <floating_point T>
+constexpr size_t GetForeignFloatSize(floating_point_format float_format)
+	noexcept;
+
+/// \brief Decomposes the native value.
+/// \param[in] value Value to decompose.
+/// \return Decomposed value.
+constexpr UnpackedFloat UnpackFloat(iso60559_sane auto value) noexcept;
+
+/// \brief Composes the native value rounding to nearest, ties to even.
+/// \tparam T Type of the result.
+/// \param[in] value Value to compose.
+/// \return Composed value. Too large values become infinity.
+template <iso60559_sane T>
+constexpr T PackFloat(const UnpackedFloat& value) noexcept;
+
+/// \brief Converts the bytes in the foreign floating point format to the
+/// native value.
+/// \tparam T Type of the result.
+/// \param[in] in_buffer Bytes to convert.
+/// \param[in] f Format of the bytes.
+/// \return Converted value.
+/// \throw std::runtime_error If given endianness is not native and native
+/// endianness is not supported.
+template <iso60559_sane T>
+constexpr T DecodeForeignFloat(span<const byte> in_buffer, format f);
+
+/// \brief Converts the native value to the bytes in the foreign floating point
+/// format.
+/// \param[in] value Value to convert.
+/// \param[in] f Format to convert to.
+/// \param[out] out_buffer Buffer to write to.
+/// \throw std::io::io_error If value is NaN and the format has no NaNs.
+/// \throw std::runtime_error If given endianness is not native and native
+/// endianness is not supported.
+/// \note Formats without infinity saturate too large values to the largest
+/// finite value.
+constexpr void EncodeForeignFloat(iso60559_sane auto value, format f,
+	span<byte> out_buffer);
+
+/// \brief Converts the bytes in the foreign floating point format to the array
+/// of native values.
+/// \param[in] in_buffer Bytes to convert. Must be at least
+/// GetForeignFloatSize bytes per value.
+/// \param[in] f Format of the bytes.
+/// \param[out] out_buffer Buffer to write to.
+/// \throw std::runtime_error If given endianness is not native and native
+/// endianness is not supported.
+template <iso60559_sane T>
+/*constexpr*/ void DecodeForeignFloats(span<const byte> in_buffer, format f,
+	span<T> out_buffer);
+
+/// \brief Converts the array of native values to the bytes in the foreign
+/// floating point format.
+/// \param[in] in_buffer Values to convert.
+/// \param[in] f Format to convert to.
+/// \param[out] out_buffer Buffer to write to. Must have room for
+/// GetForeignFloatSize bytes per value.
+/// \throw std::io::io_error If some value is NaN and the format has no NaNs.
+/// \throw std::runtime_error If given endianness is not native and native
+/// endianness is not supported.
+template <iso60559_sane T>
+/*constexpr*/ void EncodeForeignFloats(span<const T> in_buffer, format f,
+	span<byte> out_buffer);
+
+}
+
+#include "float_conversion_utilities.hpp"
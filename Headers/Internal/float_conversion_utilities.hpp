@@ -0,0 +1,787 @@
+/// \file
+/// \brief Internal header file that contains implementation of the utility
+/// functions for converting between native floating point types and non-native
+/// floating point formats.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "io_error.h"
+
+namespace std::io::Utilities
+{
+
+/// \brief Shifts the value right rounding to nearest, ties to even, taking
+/// into account the bits that were already dropped.
+/// \param[in] value Value to shift.
+/// \param[in] shift Amount of bits to shift by. Must not be negative.
+/// \param[in] sticky True if nonzero bits were dropped from the value.
+/// \return Shifted value.
+constexpr uint64_t StickyRoundingShift(uint64_t value, int shift, bool sticky)
+	noexcept
+{
+	if ((shift == 0) || (shift > 64))
+	{
+		// Either nothing is dropped or the value is less than a half.
+		return (shift == 0) ? value : 0;
+	}
+	uint64_t result = (shift == 64) ? 0 : value >> shift;
+	uint64_t remainder = (shift == 64) ? value :
+		value & ((uint64_t{1} << shift) - 1);
+	uint64_t half = uint64_t{1} << (shift - 1);
+	if ((remainder > half) ||
+		((remainder == half) && (sticky || ((result & 1) != 0))))
+	{
+		++result;
+	}
+	return result;
+}
+
+/// \brief Divides by 4 rounding towards negative infinity.
+/// \param[in] value Value to divide.
+/// \return Result of division.
+constexpr int FloorDivideBy4(int value) noexcept
+{
+	return (value >= 0) ? value / 4 : -((3 - value) / 4);
+}
+
+/// \brief Reads two halves of the value stored in the given endianness.
+/// \param[in] in_buffer Bytes to read.
+/// \param[in] f Format of the bytes.
+/// \param[in] low_size Amount of bytes of the low half.
+/// \param[out] high High half.
+/// \param[out] low Low half.
+template <typename High>
+constexpr void ReadHalves(span<const byte> in_buffer, format f,
+	size_t low_size, High& high, uint64_t& low)
+{
+	auto high_size = ranges::size(in_buffer) - low_size;
+	if (f.get_endianness() == endian::big)
+	{
+		ToNative(in_buffer.first(high_size), f, high);
+		ToNative(in_buffer.subspan(high_size, low_size), f, low);
+		return;
+	}
+	ToNative(in_buffer.first(low_size), f, low);
+	ToNative(in_buffer.subspan(low_size, high_size), f, high);
+}
+
+/// \brief Writes two halves of the value in the given endianness.
+/// \param[in] high High half.
+/// \param[in] low Low half.
+/// \param[in] f Format to write in.
+/// \param[out] out_buffer Buffer to write to.
+template <typename High>
+constexpr void WriteHalves(High high, uint64_t low, format f,
+	span<byte> out_buffer)
+{
+	if (f.get_endianness() == endian::big)
+	{
+		FromNative(high, f, out_buffer.first(sizeof(high)));
+		FromNative(low, f, out_buffer.subspan(sizeof(high), sizeof(low)));
+		return;
+	}
+	FromNative(low, f, out_buffer.first(sizeof(low)));
+	FromNative(high, f, out_buffer.subspan(sizeof(low), sizeof(high)));
+}
+
+/// \brief Converts bits of the VAX value from its in-memory order of 16-bit
+/// little endian words, most significant word first.
+/// \tparam Bits Type of the bits.
+/// \param[in] in_buffer Bytes to convert.
+/// \return Bits of the value.
+template <unsigned_integral Bits>
+constexpr Bits ReadVAXWords(span<const byte> in_buffer) noexcept
+{
+	Bits result = 0;
+	for (size_t i = 0; i < sizeof(Bits); i += 2)
+	{
+		auto word = to_integer<Bits>(in_buffer[i]) |
+			(to_integer<Bits>(in_buffer[i + 1]) << CHAR_BIT);
+		result = (result << 16) | word;
+	}
+	return result;
+}
+
+/// \brief Converts bits of the VAX value to its in-memory order of 16-bit
+/// little endian words, most significant word first.
+/// \param[in] bits Bits of the value.
+/// \param[out] out_buffer Buffer to write to.
+constexpr void WriteVAXWords(unsigned_integral auto bits,
+	span<byte> out_buffer) noexcept
+{
+	for (size_t i = sizeof(bits); i > 0; i -= 2)
+	{
+		out_buffer[i - 2] = byte{static_cast<unsigned char>(bits)};
+		out_buffer[i - 1] = byte{static_cast<unsigned char>(bits >> CHAR_BIT)};
+		bits >>= 16;
+	}
+}
+
+/// \brief Returns the power of 2 as binary64 value.
+/// \param[in] exponent Exponent within the range of normal binary64 values.
+/// \return Power of 2.
+constexpr double GetPowerOf2(int exponent) noexcept
+{
+	return bit_cast<double>(static_cast<uint64_t>(exponent + 1023) << 52);
+}
+
+constexpr bool IsForeignFloatFormat(floating_point_format float_format)
+	noexcept
+{
+	return (float_format == floating_point_format::ibm_hexadecimal) ||
+		(float_format == floating_point_format::vax) ||
+		(float_format == floating_point_format::binary128) ||
+		(float_format == floating_point_format::x87_extended);
+}
+
+template <floating_point T>
+constexpr size_t GetForeignFloatSize(floating_point_format float_format)
+	noexcept
+{
+	switch (float_format)
+	{
+		case floating_point_format::binary128:
+		{
+			return 16;
+		}
+		case floating_point_format::x87_extended:
+		{
+			return 10;
+		}
+		default:
+		{
+			return sizeof(T);
+		}
+	}
+}
+
+constexpr UnpackedFloat UnpackFloat(iso60559_sane auto value) noexcept
+{
+	using T = decltype(value);
+	using Bits = FloatBits<T>;
+	constexpr int mantissa_bits = numeric_limits<T>::digits - 1;
+	constexpr int bias = numeric_limits<T>::max_exponent - 1;
+	constexpr int max_exponent = 2 * bias + 1;
+	
+	auto bits = bit_cast<Bits>(value);
+	UnpackedFloat result;
+	result.negative = (bits >> (sizeof(bits) * CHAR_BIT - 1)) != 0;
+	auto exponent = static_cast<int>(bits >> mantissa_bits) & max_exponent;
+	uint64_t mantissa = bits & ((Bits{1} << mantissa_bits) - 1);
+	if (exponent == max_exponent)
+	{
+		result.nan = mantissa != 0;
+		result.infinity = mantissa == 0;
+		return result;
+	}
+	if (exponent == 0)
+	{
+		if (mantissa != 0)
+		{
+			auto zeroes = countl_zero(mantissa);
+			result.significand = mantissa << zeroes;
+			result.exponent = 64 - bias - mantissa_bits - zeroes;
+		}
+		return result;
+	}
+	result.significand = (mantissa | (uint64_t{1} << mantissa_bits)) <<
+		(63 - mantissa_bits);
+	result.exponent = exponent - bias;
+	return result;
+}
+
+template <iso60559_sane T>
+constexpr T PackFloat(const UnpackedFloat& value) noexcept
+{
+	using Bits = FloatBits<T>;
+	constexpr int mantissa_bits = numeric_limits<T>::digits - 1;
+	constexpr int bias = numeric_limits<T>::max_exponent - 1;
+	constexpr int max_exponent = 2 * bias + 1;
+	constexpr Bits infinity = Bits(max_exponent) << mantissa_bits;
+	
+	Bits bits = value.negative ? Bits{1} << (sizeof(Bits) * CHAR_BIT - 1) : 0;
+	if (value.nan)
+	{
+		bits |= infinity | (Bits{1} << (mantissa_bits - 1));
+	}
+	else if (value.infinity)
+	{
+		bits |= infinity;
+	}
+	else if (value.significand != 0)
+	{
+		int exponent = value.exponent + bias;
+		if (exponent >= 1)
+		{
+			auto mantissa = StickyRoundingShift(value.significand,
+				63 - mantissa_bits, value.sticky);
+			if ((mantissa >> (mantissa_bits + 1)) != 0)
+			{
+				mantissa >>= 1;
+				++exponent;
+			}
+			if (exponent >= max_exponent)
+			{
+				bits |= infinity;
+			}
+			else
+			{
+				bits |= (Bits(exponent) << mantissa_bits) |
+					(Bits(mantissa) & ((Bits{1} << mantissa_bits) - 1));
+			}
+		}
+		else
+		{
+			// Subnormal result. Rounding may carry into the smallest normal
+			// number which is encoded correctly by the same bits.
+			bits |= Bits(StickyRoundingShift(value.significand,
+				64 - mantissa_bits - exponent, value.sticky));
+		}
+	}
+	return bit_cast<T>(bits);
+}
+
+/// \brief Converts IBM hexadecimal value to the native value.
+/// \tparam T Type of the result. Single precision is used for 4 byte types
+/// and double precision otherwise.
+/// \param[in] bits Bits of the value.
+/// \return Converted value.
+template <iso60559_sane T>
+constexpr T DecodeIBM(FloatBits<T> bits) noexcept
+{
+	constexpr int width = sizeof(bits) * CHAR_BIT;
+	constexpr int fraction_bits = width - 8;
+	bool negative = (bits >> (width - 1)) != 0;
+	auto exponent = static_cast<int>(bits >> fraction_bits) & 0x7F;
+	uint64_t fraction = bits & ((FloatBits<T>{1} << fraction_bits) - 1);
+	if constexpr (iso60559_binary64<double>)
+	{
+		// The 56-bit double precision fraction is rounded when converted to
+		// binary64 while the 24-bit single precision one is rounded by the
+		// final conversion to T. The scale is a power of 2 that can't reach
+		// the subnormal range of binary64, so the product is exact and each
+		// value is rounded only once.
+		auto result = static_cast<double>(fraction) *
+			GetPowerOf2(4 * (exponent - 64) - fraction_bits);
+		return static_cast<T>(negative ? -result : result);
+	}
+	else
+	{
+		UnpackedFloat value;
+		value.negative = negative;
+		if (fraction != 0)
+		{
+			auto zeroes = countl_zero(fraction);
+			value.significand = fraction << zeroes;
+			value.exponent = 4 * (exponent - 64) - fraction_bits + 63 -
+				zeroes;
+		}
+		return PackFloat<T>(value);
+	}
+}
+
+/// \brief Converts the array of IBM hexadecimal values to the native values.
+/// \tparam T Type of the result.
+/// \param[in] in_buffer Bits of the values.
+/// \param[out] out_buffer Buffer to write to. Must have the same size as the
+/// input.
+template <iso60559_sane T>
+/*constexpr*/ void DecodeIBMValues(span<const FloatBits<T>> in_buffer,
+	span<T> out_buffer) noexcept
+{
+	size_t i = 0;
+#if defined(__AVX2__)
+	// Same operations as DecodeIBM, so the results are bit identical.
+	auto data = ranges::data(in_buffer);
+	auto out = ranges::data(out_buffer);
+	if constexpr (iso60559_binary64<T>)
+	{
+		// There is no 64-bit integer conversion, so the fraction is split to
+		// halves which are exact in binary64. Their sum rounds only once.
+		auto magic = _mm256_set1_epi64x(0x4330000000000000);
+		auto fraction_mask = _mm256_set1_epi64x((int64_t{1} << 56) - 1);
+		auto low_mask = _mm256_set1_epi64x((int64_t{1} << 28) - 1);
+		auto high_scale = _mm256_set1_pd(0x1p28);
+		auto exponent_mask = _mm256_set1_epi64x(0x7F);
+		auto bias = _mm256_set1_epi64x(1023 - 4 * 64 - 56);
+		auto sign_mask = _mm256_set1_epi64x(INT64_MIN);
+		for (; i + 4 <= out_buffer.size(); i += 4)
+		{
+			auto bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+				data + i));
+			auto fraction = _mm256_and_si256(bits, fraction_mask);
+			auto high = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+				_mm256_srli_epi64(fraction, 28), magic)),
+				_mm256_castsi256_pd(magic));
+			auto low = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+				_mm256_and_si256(fraction, low_mask), magic)),
+				_mm256_castsi256_pd(magic));
+			auto value = _mm256_add_pd(_mm256_mul_pd(high, high_scale), low);
+			auto exponent = _mm256_and_si256(_mm256_srli_epi64(bits, 56),
+				exponent_mask);
+			auto scale = _mm256_slli_epi64(_mm256_add_epi64(
+				_mm256_slli_epi64(exponent, 2), bias), 52);
+			value = _mm256_mul_pd(value, _mm256_castsi256_pd(scale));
+			value = _mm256_or_pd(value, _mm256_castsi256_pd(
+				_mm256_and_si256(bits, sign_mask)));
+			_mm256_storeu_pd(out + i, value);
+		}
+	}
+	else
+	{
+		// The 24-bit fraction is exact in binary64 and the conversion to
+		// binary32 is the only rounding.
+		auto fraction_mask = _mm_set1_epi32((1 << 24) - 1);
+		auto exponent_mask = _mm_set1_epi32(0x7F);
+		auto bias = _mm256_set1_epi64x(1023 - 4 * 64 - 24);
+		auto sign_mask = _mm_set1_epi32(INT32_MIN);
+		for (; i + 4 <= out_buffer.size(); i += 4)
+		{
+			auto bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+				data + i));
+			auto value = _mm256_cvtepi32_pd(_mm_and_si128(bits,
+				fraction_mask));
+			auto exponent = _mm256_cvtepi32_epi64(_mm_and_si128(
+				_mm_srli_epi32(bits, 24), exponent_mask));
+			auto scale = _mm256_slli_epi64(_mm256_add_epi64(
+				_mm256_slli_epi64(exponent, 2), bias), 52);
+			auto result = _mm256_cvtpd_ps(_mm256_mul_pd(value,
+				_mm256_castsi256_pd(scale)));
+			result = _mm_or_ps(result, _mm_castsi128_ps(_mm_and_si128(bits,
+				sign_mask)));
+			_mm_storeu_ps(out + i, result);
+		}
+	}
+#endif
+	for (; i < out_buffer.size(); ++i)
+	{
+		out_buffer[i] = DecodeIBM<T>(in_buffer[i]);
+	}
+}
+
+/// \brief Converts the native value to IBM hexadecimal value.
+/// \param[in] value Value to convert.
+/// \return Bits of the converted value. Single precision is used for 4 byte
+/// types and double precision otherwise.
+/// \throw std::io::io_error If value is NaN.
+constexpr auto EncodeIBM(iso60559_sane auto value)
+{
+	using Bits = FloatBits<decltype(value)>;
+	constexpr int width = sizeof(Bits) * CHAR_BIT;
+	constexpr int fraction_bits = width - 8;
+	constexpr Bits max_fraction = (Bits{1} << fraction_bits) - 1;
+	
+	auto unpacked = UnpackFloat(value);
+	if (unpacked.nan)
+	{
+		throw io_error{"EncodeIBM", io_errc::invalid_argument};
+	}
+	Bits bits = unpacked.negative ? Bits{1} << (width - 1) : 0;
+	if (unpacked.infinity)
+	{
+		return bits | (Bits{0x7F} << fraction_bits) | max_fraction;
+	}
+	if (unpacked.significand == 0)
+	{
+		return bits;
+	}
+	// Smallest power of 16 that is greater than the value. Too small values
+	// are denormalized.
+	auto power = max(FloorDivideBy4(unpacked.exponent) + 1, -64);
+	auto fraction = StickyRoundingShift(unpacked.significand,
+		63 - fraction_bits - unpacked.exponent + 4 * power, unpacked.sticky);
+	if ((fraction >> fraction_bits) != 0)
+	{
+		fraction >>= 4;
+		++power;
+	}
+	if (power > 63)
+	{
+		return bits | (Bits{0x7F} << fraction_bits) | max_fraction;
+	}
+	if (fraction == 0)
+	{
+		return bits;
+	}
+	return bits | (Bits(power + 64) << fraction_bits) | Bits(fraction);
+}
+
+/// \brief Converts VAX value to the native value.
+/// \tparam T Type of the result. F_floating is used for 4 byte types and
+/// G_floating otherwise.
+/// \param[in] bits Bits of the value.
+/// \return Converted value. Reserved operands become NaN.
+template <iso60559_sane T>
+constexpr T DecodeVAX(FloatBits<T> bits) noexcept
+{
+	constexpr int width = sizeof(bits) * CHAR_BIT;
+	constexpr int exponent_bits = (width == 32) ? 8 : 11;
+	constexpr int mantissa_bits = width - 1 - exponent_bits;
+	constexpr int bias = (1 << (exponent_bits - 1)) + 1;
+	
+	UnpackedFloat value;
+	value.negative = (bits >> (width - 1)) != 0;
+	auto exponent = static_cast<int>(bits >> mantissa_bits) &
+		((1 << exponent_bits) - 1);
+	uint64_t mantissa = bits & ((FloatBits<T>{1} << mantissa_bits) - 1);
+	if (exponent == 0)
+	{
+		// Zero with the sign bit set is a reserved operand.
+		value.nan = value.negative;
+		return PackFloat<T>(value);
+	}
+	value.significand = (mantissa | (uint64_t{1} << mantissa_bits)) <<
+		(63 - mantissa_bits);
+	value.exponent = exponent - bias;
+	return PackFloat<T>(value);
+}
+
+/// \brief Converts the native value to VAX value.
+/// \param[in] value Value to convert.
+/// \return Bits of the converted value. F_floating is used for 4 byte types
+/// and G_floating otherwise. NaN becomes reserved operand, too small values
+/// become zero.
+constexpr auto EncodeVAX(iso60559_sane auto value) noexcept
+{
+	using Bits = FloatBits<decltype(value)>;
+	constexpr int width = sizeof(Bits) * CHAR_BIT;
+	constexpr int exponent_bits = (width == 32) ? 8 : 11;
+	constexpr int mantissa_bits = width - 1 - exponent_bits;
+	constexpr int bias = (1 << (exponent_bits - 1)) + 1;
+	constexpr int max_exponent = (1 << exponent_bits) - 1;
+	constexpr Bits sign = Bits{1} << (width - 1);
+	constexpr Bits max_value = ~sign;
+	
+	auto unpacked = UnpackFloat(value);
+	if (unpacked.nan)
+	{
+		return sign;
+	}
+	Bits bits = unpacked.negative ? sign : 0;
+	if (unpacked.infinity)
+	{
+		return bits | max_value;
+	}
+	int exponent = unpacked.exponent + bias;
+	auto mantissa = StickyRoundingShift(unpacked.significand,
+		63 - mantissa_bits, unpacked.sticky);
+	if ((mantissa >> (mantissa_bits + 1)) != 0)
+	{
+		mantissa >>= 1;
+		++exponent;
+	}
+	if (exponent > max_exponent)
+	{
+		return bits | max_value;
+	}
+	if ((unpacked.significand == 0) || (exponent < 1))
+	{
+		// VAX has no negative zero and no subnormals.
+		return Bits{0};
+	}
+	return bits | (Bits(exponent) << mantissa_bits) |
+		(Bits(mantissa) & ((Bits{1} << mantissa_bits) - 1));
+}
+
+/// \brief Converts binary128 value to the native value.
+/// \tparam T Type of the result.
+/// \param[in] in_buffer Bytes to convert.
+/// \param[in] f Format of the bytes.
+/// \return Converted value.
+template <iso60559_sane T>
+constexpr T DecodeBinary128(span<const byte> in_buffer, format f)
+{
+	uint64_t high;
+	uint64_t low;
+	ReadHalves(in_buffer.first(16), f, 8, high, low);
+	UnpackedFloat value;
+	value.negative = (high >> 63) != 0;
+	auto exponent = static_cast<int>(high >> 48) & 0x7FFF;
+	high &= (uint64_t{1} << 48) - 1;
+	if (exponent == 0x7FFF)
+	{
+		value.nan = (high | low) != 0;
+		value.infinity = (high | low) == 0;
+		return PackFloat<T>(value);
+	}
+	if (exponent != 0)
+	{
+		high |= uint64_t{1} << 48;
+	}
+	else if ((high | low) == 0)
+	{
+		return PackFloat<T>(value);
+	}
+	// Normalize 113-bit significand to 64 bits keeping the rest as
+	// the sticky bit.
+	auto zeroes = (high != 0) ? countl_zero(high) :
+		64 + countl_zero(low);
+	if (zeroes < 64)
+	{
+		value.significand = (high << zeroes) |
+			((zeroes == 0) ? 0 : low >> (64 - zeroes));
+		value.sticky = (low << zeroes) != 0;
+	}
+	else
+	{
+		value.significand = low << (zeroes - 64);
+	}
+	value.exponent = max(exponent, 1) - 16383 - 112 + 127 - zeroes;
+	return PackFloat<T>(value);
+}
+
+/// \brief Converts x87 extended precision value to the native value.
+/// \tparam T Type of the result.
+/// \param[in] in_buffer Bytes to convert.
+/// \param[in] f Format of the bytes.
+/// \return Converted value. Unnormals become NaN.
+template <iso60559_sane T>
+constexpr T DecodeX87(span<const byte> in_buffer, format f)
+{
+	uint16_t sign_exponent;
+	uint64_t significand;
+	ReadHalves(in_buffer.first(10), f, 8, sign_exponent, significand);
+	UnpackedFloat value;
+	value.negative = (sign_exponent >> 15) != 0;
+	auto exponent = sign_exponent & 0x7FFF;
+	if (exponent == 0x7FFF)
+	{
+		value.nan = (significand << 1) != 0;
+		value.infinity = (significand << 1) == 0;
+		return PackFloat<T>(value);
+	}
+	if (significand == 0)
+	{
+		return PackFloat<T>(value);
+	}
+	if ((exponent != 0) && ((significand >> 63) == 0))
+	{
+		// Unnormals are invalid operands on modern processors.
+		value.nan = true;
+		return PackFloat<T>(value);
+	}
+	auto zeroes = countl_zero(significand);
+	value.significand = significand << zeroes;
+	value.exponent = max(exponent, 1) - 16383 - zeroes;
+	return PackFloat<T>(value);
+}
+
+template <iso60559_sane T>
+constexpr T DecodeForeignFloat(span<const byte> in_buffer, format f)
+{
+	switch (f.get_floating_point_format())
+	{
+		case floating_point_format::ibm_hexadecimal:
+		{
+			FloatBits<T> bits;
+			ToNative(in_buffer.first(sizeof(bits)), f, bits);
+			return DecodeIBM<T>(bits);
+		}
+		case floating_point_format::vax:
+		{
+			return DecodeVAX<T>(ReadVAXWords<FloatBits<T>>(in_buffer));
+		}
+		case floating_point_format::binary128:
+		{
+			return DecodeBinary128<T>(in_buffer, f);
+		}
+		default:
+		{
+			return DecodeX87<T>(in_buffer, f);
+		}
+	}
+}
+
+/// \brief Converts the native value to binary128 value.
+/// \param[in] value Value to convert.
+/// \param[in] f Format to convert to.
+/// \param[out] out_buffer Buffer to write to.
+constexpr void EncodeBinary128(iso60559_sane auto value, format f,
+	span<byte> out_buffer)
+{
+	// Every binary32 and binary64 value is exact in binary128.
+	auto unpacked = UnpackFloat(value);
+	uint64_t high = unpacked.negative ? uint64_t{1} << 63 : 0;
+	uint64_t low = 0;
+	if (unpacked.nan || unpacked.infinity)
+	{
+		high |= uint64_t{0x7FFF} << 48;
+		if (unpacked.nan)
+		{
+			high |= uint64_t{1} << 47;
+		}
+	}
+	else if (unpacked.significand != 0)
+	{
+		auto fraction = unpacked.significand << 1;
+		high |= (static_cast<uint64_t>(unpacked.exponent + 16383) <<
+			48) | (fraction >> 16);
+		low = fraction << 48;
+	}
+	WriteHalves(high, low, f, out_buffer.first(16));
+}
+
+/// \brief Converts the native value to x87 extended precision value.
+/// \param[in] value Value to convert.
+/// \param[in] f Format to convert to.
+/// \param[out] out_buffer Buffer to write to.
+constexpr void EncodeX87(iso60559_sane auto value, format f,
+	span<byte> out_buffer)
+{
+	// Every binary32 and binary64 value is exact in x87 format.
+	auto unpacked = UnpackFloat(value);
+	uint16_t sign_exponent = unpacked.negative ? 0x8000 : 0;
+	uint64_t significand = 0;
+	if (unpacked.nan || unpacked.infinity)
+	{
+		sign_exponent |= 0x7FFF;
+		significand = unpacked.nan ? uint64_t{3} << 62 :
+			uint64_t{1} << 63;
+	}
+	else if (unpacked.significand != 0)
+	{
+		sign_exponent |= static_cast<uint16_t>(unpacked.exponent +
+			16383);
+		significand = unpacked.significand;
+	}
+	WriteHalves(sign_exponent, significand, f, out_buffer.first(10));
+}
+
+constexpr void EncodeForeignFloat(iso60559_sane auto value, format f,
+	span<byte> out_buffer)
+{
+	switch (f.get_floating_point_format())
+	{
+		case floating_point_format::ibm_hexadecimal:
+		{
+			auto bits = EncodeIBM(value);
+			FromNative(bits, f, out_buffer.first(sizeof(bits)));
+			return;
+		}
+		case floating_point_format::vax:
+		{
+			WriteVAXWords(EncodeVAX(value), out_buffer);
+			return;
+		}
+		case floating_point_format::binary128:
+		{
+			EncodeBinary128(value, f, out_buffer);
+			return;
+		}
+		default:
+		{
+			EncodeX87(value, f, out_buffer);
+			return;
+		}
+	}
+}
+
+template <iso60559_sane T>
+/*constexpr*/ void DecodeForeignFloats(span<const byte> in_buffer, format f,
+	span<T> out_buffer)
+{
+	auto size = GetForeignFloatSize<T>(f.get_floating_point_format());
+	switch (f.get_floating_point_format())
+	{
+		case floating_point_format::ibm_hexadecimal:
+		{
+			// Stage the bits so that the values are decoded in a tight loop.
+			array<FloatBits<T>, 512> bits;
+			while (!out_buffer.empty())
+			{
+				auto count = min(out_buffer.size(), bits.size());
+				for (size_t i = 0; i < count; ++i)
+				{
+					ToNative(in_buffer.subspan(i * size, size), f, bits[i]);
+				}
+				DecodeIBMValues<T>(span<const FloatBits<T>>{bits}.first(count),
+					out_buffer.first(count));
+				in_buffer = in_buffer.subspan(count * size);
+				out_buffer = out_buffer.subspan(count);
+			}
+			return;
+		}
+		case floating_point_format::vax:
+		{
+			for (size_t i = 0; i < out_buffer.size(); ++i)
+			{
+				out_buffer[i] = DecodeVAX<T>(ReadVAXWords<FloatBits<T>>(
+					in_buffer.subspan(i * size, size)));
+			}
+			return;
+		}
+		case floating_point_format::binary128:
+		{
+			for (size_t i = 0; i < out_buffer.size(); ++i)
+			{
+				out_buffer[i] = DecodeBinary128<T>(in_buffer.subspan(i * size,
+					size), f);
+			}
+			return;
+		}
+		default:
+		{
+			for (size_t i = 0; i < out_buffer.size(); ++i)
+			{
+				out_buffer[i] = DecodeX87<T>(in_buffer.subspan(i * size, size),
+					f);
+			}
+			return;
+		}
+	}
+}
+
+template <iso60559_sane T>
+/*constexpr*/ void EncodeForeignFloats(span<const T> in_buffer, format f,
+	span<byte> out_buffer)
+{
+	auto size = GetForeignFloatSize<T>(f.get_floating_point_format());
+	switch (f.get_floating_point_format())
+	{
+		case floating_point_format::ibm_hexadecimal:
+		{
+			for (size_t i = 0; i < in_buffer.size(); ++i)
+			{
+				FromNative(EncodeIBM(in_buffer[i]), f,
+					out_buffer.subspan(i * size, size));
+			}
+			return;
+		}
+		case floating_point_format::vax:
+		{
+			for (size_t i = 0; i < in_buffer.size(); ++i)
+			{
+				WriteVAXWords(EncodeVAX(in_buffer[i]),
+					out_buffer.subspan(i * size, size));
+			}
+			return;
+		}
+		case floating_point_format::binary128:
+		{
+			for (size_t i = 0; i < in_buffer.size(); ++i)
+			{
+				EncodeBinary128(in_buffer[i], f, out_buffer.subspan(i * size,
+					size));
+			}
+			return;
+		}
+		default:
+		{
+			for (size_t i = 0; i < in_buffer.size(); ++i)
+			{
+				EncodeX87(in_buffer[i], f, out_buffer.subspan(i * size, size));
+			}
+			return;
+		}
+	}
+}
+
+}
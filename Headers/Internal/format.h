@@ -13,7 +13,29 @@ namespace std::io
 enum class floating_point_format
 {
 	iec559,
-	native
+	native,
+	binary16,
+	bfloat16,
+	ibm_hexadecimal,
+	vax,
+	binary128,
+	x87_extended
+};
+
+enum class integer_format
+{
+	fixed,
+	leb128,
+	group_varint,
+	delta_bit_packed
+};
+
+enum class length_prefix_width
+{
+	one_byte,
+	two_bytes,
+	four_bytes,
+	eight_bytes
 };
 
 class format final
@@ -21,7 +43,9 @@ class format final
 public:
 	// Constructor
 	constexpr format(endian endianness = endian::native,
-		floating_point_format float_format = floating_point_format::native)
+		floating_point_format float_format = floating_point_format::native,
+		integer_format int_format = integer_format::fixed,
+		length_prefix_width length_width = length_prefix_width::eight_bytes)
 		noexcept;
 	
 	// Member functions
@@ -30,6 +54,11 @@ public:
 	constexpr floating_point_format get_floating_point_format() const noexcept;
 	constexpr void set_floating_point_format(floating_point_format new_format)
 		noexcept;
+	constexpr integer_format get_integer_format() const noexcept;
+	constexpr void set_integer_format(integer_format new_format) noexcept;
+	constexpr length_prefix_width get_length_prefix_width() const noexcept;
+	constexpr void set_length_prefix_width(length_prefix_width new_width)
+		noexcept;
 	
 	// Equality
 	friend constexpr bool operator==(const format& lhs, const format& rhs)
@@ -37,6 +66,8 @@ public:
 private:
 	endian m_endianness;
 	floating_point_format m_float_format;
+	integer_format m_int_format;
+	length_prefix_width m_length_width;
 };
 
 }
@@ -9,10 +9,12 @@
 namespace std::io
 {
 
-constexpr format::format(endian endianness, floating_point_format float_format)
-	noexcept
+constexpr format::format(endian endianness, floating_point_format float_format,
+	integer_format int_format, length_prefix_width length_width) noexcept
 	: m_endianness{endianness},
-	m_float_format{float_format}
+	m_float_format{float_format},
+	m_int_format{int_format},
+	m_length_width{length_width}
 {
 }
 
@@ -38,4 +40,25 @@ constexpr void format::set_floating_point_format(
 	m_float_format = new_format;
 }
 
+constexpr integer_format format::get_integer_format() const noexcept
+{
+	return m_int_format;
+}
+
+constexpr void format::set_integer_format(integer_format new_format) noexcept
+{
+	m_int_format = new_format;
+}
+
+constexpr length_prefix_width format::get_length_prefix_width() const noexcept
+{
+	return m_length_width;
+}
+
+constexpr void format::set_length_prefix_width(length_prefix_width new_width)
+	noexcept
+{
+	m_length_width = new_width;
+}
+
 }
@@ -19,7 +19,7 @@ concept iso60559 = floating_point<T> && (numeric_limits<T>::is_iec559 == true);
 template <typename T>
 concept iso60559_binary32 = iso60559<T> &&
 	(numeric_limits<T>::radix == 2) &&
-	(numeric_limits<T>::digits = 24) &&
+	(numeric_limits<T>::digits == 24) &&
 	(numeric_limits<T>::min_exponent == -125) &&
 	(numeric_limits<T>::max_exponent == 128) &&
 	(sizeof(T) * CHAR_BIT == 32);
@@ -28,7 +28,7 @@ concept iso60559_binary32 = iso60559<T> &&
 template <typename T>
 concept iso60559_binary64 = iso60559<T> &&
 	(numeric_limits<T>::radix == 2) &&
-	(numeric_limits<T>::digits = 53) &&
+	(numeric_limits<T>::digits == 53) &&
 	(numeric_limits<T>::min_exponent == -1021) &&
 	(numeric_limits<T>::max_exponent == 1024) &&
 	(sizeof(T) * CHAR_BIT == 64);
@@ -37,12 +37,24 @@ concept iso60559_binary64 = iso60559<T> &&
 template <typename T>
 concept iso60559_sane = iso60559_binary32<T> || iso60559_binary64<T>;
 
+/// \brief Copies the object representation of the given type from the bytes.
+/// \tparam T Type of the object.
+/// \param[in] in_buffer Buffer with at least sizeof(T) bytes.
+/// \return Object with the same object representation.
+template <typename T>
+constexpr T LoadObject(span<const byte> in_buffer) noexcept;
+
+/// \brief Copies the object representation of the given object to the bytes.
+/// \param[in] object Object to copy.
+/// \param[out] out_buffer Buffer with room for at least sizeof(object) bytes.
+constexpr void StoreObject(const auto& object, span<byte> out_buffer) noexcept;
+
 /// \brief Converts given bytes in the specified format to the integral object
 /// in the native format.
 /// \param[in] in_buffer Buffer with bytes to transform.
 /// \param[in] f Format of the bytes.
 /// \param[out] object Object to write to.
-/*constexpr*/ void ToNative(span<const byte> in_buffer, format f,
+constexpr void ToNative(span<const byte> in_buffer, format f,
 	integral auto& object);
 
 /// \brief Converts given bytes in the specified format to the floating point
@@ -52,7 +64,7 @@ concept iso60559_sane = iso60559_binary32<T> || iso60559_binary64<T>;
 /// \param[out] object Object to write to.
 /// \throw std::runtime_error If floating point format or endianness is not
 /// supported.
-/*constexpr*/ void ToNative(span<const byte> in_buffer, format f,
+constexpr void ToNative(span<const byte> in_buffer, format f,
 	floating_point auto& object);
 
 /// \brief Converts given bytes in the specified format to the ISO 60559 object
@@ -62,7 +74,8 @@ concept iso60559_sane = iso60559_binary32<T> || iso60559_binary64<T>;
 /// \param[out] object Object to write to.
 /// \throw std::runtime_error If given endianness is not native and native
 /// endianness is not supported.
-/*constexpr*/ void ToISO60559(span<const byte> in_buffer, format f,
+/// \note Only GetFloatingPointSize bytes are read.
+constexpr void ToISO60559(span<const byte> in_buffer, format f,
 	iso60559_sane auto& object);
 
 /// \brief Converts given integral object in the native format to the bytes in
@@ -73,7 +86,7 @@ concept iso60559_sane = iso60559_binary32<T> || iso60559_binary64<T>;
 /// \param[out] out_buffer Buffer to write to.
 template <typename T>
 requires integral<T> || is_enum_v<T>
-/*constexpr*/ void FromNative(T object, format f, span<byte> out_buffer);
+constexpr void FromNative(T object, format f, span<byte> out_buffer);
 
 /// \brief Converts given floating point object in the native format to the
 /// bytes in the specified format.
@@ -82,7 +95,7 @@ requires integral<T> || is_enum_v<T>
 /// \param[out] out_buffer Buffer to write to.
 /// \throw std::runtime_error If floating point format or endianness is not
 /// supported.
-/*constexpr*/ void FromNative(floating_point auto object, format f,
+constexpr void FromNative(floating_point auto object, format f,
 	span<byte> out_buffer);
 
 /// \brief Converts given ISO 60559 object in the native format to the bytes in
@@ -92,7 +105,48 @@ requires integral<T> || is_enum_v<T>
 /// \param[out] out_buffer Buffer to write to.
 /// \throw std::runtime_error If given endianness is not native and native
 /// endianness is not supported.
-/*constexpr*/ void FromISO60559(iso60559_sane auto object, format f,
+/// \throw std::io::io_error If the format can't represent the object.
+/// \note Only GetFloatingPointSize bytes are written.
+constexpr void FromISO60559(iso60559_sane auto object, format f,
+	span<byte> out_buffer);
+
+/// \brief Returns the amount of bytes the floating point object occupies in
+/// the given format.
+/// \tparam T Type of the floating point object.
+/// \param[in] f Format to check.
+/// \return Amount of bytes.
+template <floating_point T>
+constexpr size_t GetFloatingPointSize(format f) noexcept;
+
+/// \brief Maximum amount of bytes the floating point object of the given type
+/// can occupy in any supported format.
+template <floating_point T>
+inline constexpr size_t MaxFloatingPointSize = (sizeof(T) > 16) ? sizeof(T) :
+	16;
+
+/// \brief Converts given bytes in the specified format to the array of ISO
+/// 60559 objects in the native format.
+/// \param[in] in_buffer Buffer with bytes to transform. Must contain
+/// GetFloatingPointSize bytes per object.
+/// \param[in] f Format of the bytes.
+/// \param[out] out_buffer Buffer to write to.
+/// \throw std::runtime_error If given endianness is not native and native
+/// endianness is not supported.
+template <iso60559_sane T>
+/*constexpr*/ void ToNativeFloats(span<const byte> in_buffer, format f,
+	span<T> out_buffer);
+
+/// \brief Converts given array of ISO 60559 objects in the native format to
+/// the bytes in the specified format.
+/// \param[in] in_buffer Objects to convert.
+/// \param[in] f Format to convert to.
+/// \param[out] out_buffer Buffer to write to. Must have room for
+/// GetFloatingPointSize bytes per object.
+/// \throw std::io::io_error If the format can't represent some object.
+/// \throw std::runtime_error If given endianness is not native and native
+/// endianness is not supported.
+template <iso60559_sane T>
+/*constexpr*/ void FromNativeFloats(span<const T> in_buffer, format f,
 	span<byte> out_buffer);
 
 /// \brief Swaps bytes of the given buffer if the given endianness requires it.
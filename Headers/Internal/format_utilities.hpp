@@ -7,34 +7,55 @@
 #pragma once
 
 #include <cstddef>
-#include <cstring>
 #include <algorithm>
+#include <array>
+#include <bit>
+
+#include "half_float_utilities.h"
+#include "float_conversion_utilities.h"
 
 namespace std::io::Utilities
 {
 
-/*constexpr*/ void ToNative(span<const byte> in_buffer, format f,
+template <typename T>
+constexpr T LoadObject(span<const byte> in_buffer) noexcept
+{
+	array<byte, sizeof(T)> buffer;
+	ranges::copy_n(ranges::begin(in_buffer), sizeof(T), ranges::begin(buffer));
+	return bit_cast<T>(buffer);
+}
+
+constexpr void StoreObject(const auto& object, span<byte> out_buffer) noexcept
+{
+	auto buffer = bit_cast<array<byte, sizeof(object)>>(object);
+	ranges::copy(buffer, ranges::begin(out_buffer));
+}
+
+constexpr void ToNative(span<const byte> in_buffer, format f,
 	integral auto& object)
 {
 	if constexpr (sizeof(object) == 1)
 	{
-		object = to_integer<decltype(object)>(in_buffer[0]);
+		object = to_integer<remove_reference_t<decltype(object)>>(
+			in_buffer[0]);
 		return;
 	}
 	auto endianness = f.get_endianness();
+	using T = remove_reference_t<decltype(object)>;
 	if (endianness == endian::native)
 	{
-		// TODO: bit_cast.
-		memcpy(&object, ranges::data(in_buffer), sizeof(object));
+		object = LoadObject<T>(in_buffer);
 		return;
 	}
-	make_unsigned_t<remove_reference_t<decltype(object)>> out_buffer = 0;
+	using U = make_unsigned_t<T>;
+	U out_buffer = 0;
 	if (endianness == endian::little)
 	{
 		auto it = ranges::begin(in_buffer);
 		for (size_t i = 0; i < sizeof(object); ++i)
 		{
-			out_buffer += to_integer<unsigned char>(*it) << (CHAR_BIT * i);
+			out_buffer += static_cast<U>(to_integer<unsigned char>(*it)) <<
+				(CHAR_BIT * i);
 			++it;
 		}
 	}
@@ -43,25 +64,24 @@ namespace std::io::Utilities
 		auto it = ranges::rbegin(in_buffer);
 		for (size_t i = 0; i < sizeof(object); ++i)
 		{
-			out_buffer += to_integer<unsigned char>(*it) << (CHAR_BIT * i);
+			out_buffer += static_cast<U>(to_integer<unsigned char>(*it)) <<
+				(CHAR_BIT * i);
 			++it;
 		}
 	}
-	// TODO: bit_cast.
-	memcpy(&object, &out_buffer, sizeof(object));
+	object = bit_cast<T>(out_buffer);
 }
 
-/*constexpr*/ void ToNative(span<const byte> in_buffer, format f,
+constexpr void ToNative(span<const byte> in_buffer, format f,
 	floating_point auto& object)
 {
 	auto float_format = f.get_floating_point_format();
 	if (float_format == floating_point_format::native)
 	{
-		// TODO: bit_cast.
-		memcpy(&object, ranges::data(in_buffer), sizeof(object));
+		object = LoadObject<remove_reference_t<decltype(object)>>(in_buffer);
 		return;
 	}
-	if constexpr (iso60559_sane<decltype(object)>)
+	if constexpr (iso60559_sane<remove_reference_t<decltype(object)>>)
 	{
 		ToISO60559(in_buffer, f, object);
 		return;
@@ -73,32 +93,44 @@ namespace std::io::Utilities
 	}
 }
 
-/*constexpr*/ void ToISO60559(span<const byte> in_buffer, format f,
+constexpr void ToISO60559(span<const byte> in_buffer, format f,
 	iso60559_sane auto& object)
 {
+	auto float_format = f.get_floating_point_format();
+	if (IsHalfFloatFormat(float_format))
+	{
+		uint16_t value;
+		ToNative(in_buffer.first(sizeof(value)), f, value);
+		object = WidenFloat<remove_reference_t<decltype(object)>>(value,
+			float_format);
+		return;
+	}
+	if (IsForeignFloatFormat(float_format))
+	{
+		object = DecodeForeignFloat<remove_reference_t<decltype(object)>>(
+			in_buffer, f);
+		return;
+	}
 	array<byte, sizeof(object)> buffer;
 	ranges::copy(ranges::begin(in_buffer), ranges::begin(in_buffer) +
 		sizeof(object), ranges::begin(buffer));
 	SwapBytes(f.get_endianness(), buffer);
-	// TODO: bit_cast.
-	memcpy(&object, ranges::data(buffer), sizeof(object));
+	object = bit_cast<remove_reference_t<decltype(object)>>(buffer);
 }
 
 template <typename T>
 requires integral<T> || is_enum_v<T>
-/*constexpr*/ void FromNative(T object, format f, span<byte> out_buffer)
+constexpr void FromNative(T object, format f, span<byte> out_buffer)
 {
 	if constexpr (sizeof(object) == 1)
 	{
-		// TODO: bit_cast.
-		memcpy(ranges::data(out_buffer), &object, sizeof(object));
+		StoreObject(object, out_buffer);
 		return;
 	}
 	auto endianness = f.get_endianness();
 	if (endianness == endian::native)
 	{
-		// TODO: bit_cast.
-		memcpy(ranges::data(out_buffer), &object, sizeof(object));
+		StoreObject(object, out_buffer);
 		return;
 	}
 	auto unsigned_value =
@@ -125,14 +157,13 @@ requires integral<T> || is_enum_v<T>
 	}
 }
 
-/*constexpr*/ void FromNative(floating_point auto object, format f,
+constexpr void FromNative(floating_point auto object, format f,
 	span<byte> out_buffer)
 {
 	auto float_format = f.get_floating_point_format();
 	if (float_format == floating_point_format::native)
 	{
-		// TODO: bit_cast.
-		memcpy(ranges::data(out_buffer), &object, sizeof(object));
+		StoreObject(object, out_buffer);
 		return;
 	}
 	if constexpr (iso60559_sane<decltype(object)>)
@@ -147,12 +178,90 @@ requires integral<T> || is_enum_v<T>
 	}
 }
 
-/*constexpr*/ void FromISO60559(iso60559_sane auto object, format f,
+constexpr void FromISO60559(iso60559_sane auto object, format f,
+	span<byte> out_buffer)
+{
+	auto float_format = f.get_floating_point_format();
+	if (IsHalfFloatFormat(float_format))
+	{
+		auto value = NarrowFloat(object, float_format);
+		FromNative(value, f, out_buffer.first(sizeof(value)));
+		return;
+	}
+	if (IsForeignFloatFormat(float_format))
+	{
+		EncodeForeignFloat(object, f, out_buffer);
+		return;
+	}
+	StoreObject(object, out_buffer);
+	SwapBytes(f.get_endianness(), out_buffer.first(sizeof(object)));
+}
+
+template <floating_point T>
+constexpr size_t GetFloatingPointSize(format f) noexcept
+{
+	auto float_format = f.get_floating_point_format();
+	if (IsHalfFloatFormat(float_format))
+	{
+		return 2;
+	}
+	if (IsForeignFloatFormat(float_format))
+	{
+		return GetForeignFloatSize<T>(float_format);
+	}
+	return sizeof(T);
+}
+
+template <iso60559_sane T>
+/*constexpr*/ void ToNativeFloats(span<const byte> in_buffer, format f,
+	span<T> out_buffer)
+{
+	auto float_format = f.get_floating_point_format();
+	if (IsHalfFloatFormat(float_format))
+	{
+		WidenFloats(in_buffer, f, out_buffer);
+		return;
+	}
+	if (IsForeignFloatFormat(float_format))
+	{
+		DecodeForeignFloats(in_buffer, f, out_buffer);
+		return;
+	}
+	auto endianness = (float_format == floating_point_format::native) ?
+		endian::native : f.get_endianness();
+	for (size_t i = 0; i < out_buffer.size(); ++i)
+	{
+		array<byte, sizeof(T)> buffer;
+		ranges::copy_n(ranges::begin(in_buffer) + i * sizeof(T), sizeof(T),
+			ranges::begin(buffer));
+		SwapBytes(endianness, buffer);
+		out_buffer[i] = bit_cast<T>(buffer);
+	}
+}
+
+template <iso60559_sane T>
+/*constexpr*/ void FromNativeFloats(span<const T> in_buffer, format f,
 	span<byte> out_buffer)
 {
-	// TODO: bit_cast.
-	memcpy(ranges::data(out_buffer), &object, sizeof(object));
-	SwapBytes(f.get_endianness(), out_buffer);
+	auto float_format = f.get_floating_point_format();
+	if (IsHalfFloatFormat(float_format))
+	{
+		NarrowFloats(in_buffer, f, out_buffer);
+		return;
+	}
+	if (IsForeignFloatFormat(float_format))
+	{
+		EncodeForeignFloats(in_buffer, f, out_buffer);
+		return;
+	}
+	auto endianness = (float_format == floating_point_format::native) ?
+		endian::native : f.get_endianness();
+	for (size_t i = 0; i < in_buffer.size(); ++i)
+	{
+		auto buffer = out_buffer.subspan(i * sizeof(T), sizeof(T));
+		StoreObject(in_buffer[i], buffer);
+		SwapBytes(endianness, buffer);
+	}
 }
 
 constexpr void SwapBytes(endian endianness, span<byte> buffer)
@@ -0,0 +1,74 @@
+/// \file
+/// \brief Internal header file that describes growth policies of dynamic
+/// memory streams.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <cstddef>
+
+namespace std::io
+{
+
+/// \brief Growth policy that multiplies capacity of the stream buffer by a
+/// constant factor so that appending takes amortized constant time.
+/// \details Growth policy is a class with a member function
+/// get_capacity(size_t capacity, size_t required_size) that returns the new
+/// capacity of the buffer which is at least the required size.
+/// Growth factor is numerator / denominator. Both must be nonzero and the
+/// factor must not be less than 1, otherwise the constructor throws
+/// std::io::io_error with io_errc::invalid_argument.
+
+class geometric_growth final
+{
+public:
+	// Constructor
+	constexpr geometric_growth(size_t numerator = 2, size_t denominator = 1);
+	
+	// Growth
+	constexpr size_t get_capacity(size_t capacity, size_t required_size) const
+		noexcept;
+private:
+	size_t m_numerator; ///< Numerator of the growth factor.
+	size_t m_denominator; ///< Denominator of the growth factor.
+};
+
+/// \brief Growth policy that grows capacity of the stream buffer exactly to the
+/// required size.
+
+class exact_growth final
+{
+public:
+	// Growth
+	constexpr size_t get_capacity(size_t capacity, size_t required_size) const
+		noexcept;
+};
+
+namespace Utilities
+{
+
+/// \brief Growth policy of dynamic memory streams.
+template <typename G>
+concept growth_policy = requires(const G growth, size_t size)
+	{
+		{growth.get_capacity(size, size)} -> same_as<size_t>;
+	};
+
+/// \brief Reserves the capacity for the given size in the stream buffer
+/// according to the growth policy. Does nothing if the buffer has no reserve
+/// member function.
+/// \tparam Buffer Type of the stream buffer.
+/// \param[in,out] buffer Stream buffer to reserve capacity in.
+/// \param[in] required_size Size that must fit into the buffer.
+/// \param[in] growth Growth policy to use.
+/// \throw std::bad_alloc If there was not enough memory.
+template <typename Buffer>
+constexpr void ReserveBuffer(Buffer& buffer, size_t required_size,
+	const growth_policy auto& growth);
+
+}
+
+}
+
+#include "growth_policy.hpp"
@@ -0,0 +1,65 @@
+/// \file
+/// \brief Internal header file that contains implementation of growth
+/// policies of dynamic memory streams.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "io_error.h"
+
+namespace std::io
+{
+
+constexpr geometric_growth::geometric_growth(size_t numerator,
+	size_t denominator)
+	: m_numerator{numerator},
+	m_denominator{denominator}
+{
+	if ((denominator == 0) || (numerator < denominator))
+	{
+		throw io_error{"geometric_growth", io_errc::invalid_argument};
+	}
+}
+
+constexpr size_t geometric_growth::get_capacity(size_t capacity,
+	size_t required_size) const noexcept
+{
+	// Saturate instead of overflowing on huge buffers.
+	auto grown = (capacity > numeric_limits<size_t>::max() / m_numerator) ?
+		numeric_limits<size_t>::max() : capacity * m_numerator / m_denominator;
+	return max(grown, required_size);
+}
+
+constexpr size_t exact_growth::get_capacity(size_t, size_t required_size)
+	const noexcept
+{
+	return required_size;
+}
+
+namespace Utilities
+{
+
+template <typename Buffer>
+constexpr void ReserveBuffer(Buffer& buffer, size_t required_size,
+	const growth_policy auto& growth)
+{
+	if constexpr (requires { buffer.reserve(required_size); })
+	{
+		auto capacity = static_cast<size_t>(buffer.capacity());
+		if (capacity >= required_size)
+		{
+			return;
+		}
+		auto new_capacity = min(growth.get_capacity(capacity, required_size),
+			static_cast<size_t>(buffer.max_size()));
+		buffer.reserve(max(new_capacity, required_size));
+	}
+}
+
+}
+
+}
@@ -0,0 +1,90 @@
+/// \file
+/// \brief Internal header file that describes the utility functions for
+/// converting between native floating point types and 16-bit floating point
+/// formats.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+
+namespace std::io::Utilities
+{
+
+/// \brief Unsigned integer type with the same size as the given floating point
+/// type.
+template <typename T>
+using FloatBits = conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t,
+	uint64_t>;
+
+/// \brief Checks if the given floating point format is one of the 16-bit
+/// formats.
+/// \param[in] float_format Format to check.
+/// \return True if format is binary16 or bfloat16.
+constexpr bool IsHalfFloatFormat(floating_point_format float_format) noexcept;
+
+/// \brief Converts the given value to 16-bit binary floating point format with
+/// the given layout. Rounds to nearest, ties to even.
+/// \tparam ExponentBits Amount of exponent bits of the result.
+/// \tparam MantissaBits Amount of explicit mantissa bits of the result.
+/// \param[in] value Value to convert.
+/// \return Bits of the converted value.
+template <int ExponentBits, int MantissaBits>
+constexpr uint16_t NarrowFloat(iso60559_sane auto value) noexcept;
+
+/// \brief Converts the given 16-bit binary floating point value with the given
+/// layout to the native type. Conversion is exact, signaling NaNs are quieted.
+/// \tparam T Type of the result.
+/// \tparam ExponentBits Amount of exponent bits of the value.
+/// \tparam MantissaBits Amount of explicit mantissa bits of the value.
+/// \param[in] value Bits of the value to convert.
+/// \return Converted value.
+template <iso60559_sane T, int ExponentBits, int MantissaBits>
+constexpr T WidenFloat(uint16_t value) noexcept;
+
+/// \brief Converts the given value to the 16-bit floating point format.
+/// \param[in] value Value to convert.
+/// \param[in] float_format Either binary16 or bfloat16.
+/// \return Bits of the converted value.
+constexpr uint16_t NarrowFloat(iso60559_sane auto value,
+	floating_point_format float_format) noexcept;
+
+/// \brief Converts the given value in the 16-bit floating point format to the
+/// native type.
+/// \tparam T Type of the result.
+/// \param[in] value Bits of the value to convert.
+/// \param[in] float_format Either binary16 or bfloat16.
+/// \return Converted value.
+template <iso60559_sane T>
+constexpr T WidenFloat(uint16_t value, floating_point_format float_format)
+	noexcept;
+
+/// \brief Converts the array of native values to the bytes in the 16-bit
+/// floating point format.
+/// \param[in] in_buffer Values to convert.
+/// \param[in] f Format to convert to.
+/// \param[out] out_buffer Buffer to write to. Must be at least 2 bytes per
+/// value.
+/// \throw std::runtime_error If given endianness is not native and native
+/// endianness is not supported.
+template <iso60559_sane T>
+/*constexpr*/ void NarrowFloats(span<const T> in_buffer, format f,
+	span<byte> out_buffer);
+
+/// \brief Converts the bytes in the 16-bit floating point format to the array
+/// of native values.
+/// \param[in] in_buffer Bytes to convert. Must be at least 2 bytes per value.
+/// \param[in] f Format to convert from.
+/// \param[out] out_buffer Buffer to write to.
+/// \throw std::runtime_error If given endianness is not native and native
+/// endianness is not supported.
+template <iso60559_sane T>
+/*constexpr*/ void WidenFloats(span<const byte> in_buffer, format f,
+	span<T> out_buffer);
+
+}
+
+#include "half_float_utilities.hpp"
@@ -0,0 +1,234 @@
+/// \file
+/// \brief Internal header file that contains implementation of the utility
+/// functions for converting between native floating point types and 16-bit
+/// floating point formats.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <bit>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace std::io::Utilities
+{
+
+/// \brief Shifts the value right rounding to nearest, ties to even.
+/// \param[in] value Value to shift.
+/// \param[in] shift Amount of bits to shift by. Must be positive.
+/// \return Shifted value.
+template <unsigned_integral Bits>
+constexpr Bits RoundingShift(Bits value, int shift) noexcept
+{
+	if (shift >= static_cast<int>(sizeof(Bits) * CHAR_BIT))
+	{
+		// Mantissa is always less than half of the type range.
+		return 0;
+	}
+	Bits result = value >> shift;
+	Bits remainder = value & ((Bits{1} << shift) - 1);
+	Bits half = Bits{1} << (shift - 1);
+	if ((remainder > half) || ((remainder == half) && ((result & 1) != 0)))
+	{
+		++result;
+	}
+	return result;
+}
+
+constexpr bool IsHalfFloatFormat(floating_point_format float_format) noexcept
+{
+	return (float_format == floating_point_format::binary16) ||
+		(float_format == floating_point_format::bfloat16);
+}
+
+template <int ExponentBits, int MantissaBits>
+constexpr uint16_t NarrowFloat(iso60559_sane auto value) noexcept
+{
+	using T = decltype(value);
+	using Bits = FloatBits<T>;
+	constexpr int source_mantissa_bits = numeric_limits<T>::digits - 1;
+	constexpr int source_bias = numeric_limits<T>::max_exponent - 1;
+	constexpr int source_max_exponent = 2 * source_bias + 1;
+	constexpr int bias = (1 << (ExponentBits - 1)) - 1;
+	constexpr int max_exponent = 2 * bias + 1;
+	constexpr int shift = source_mantissa_bits - MantissaBits;
+	constexpr uint16_t infinity = max_exponent << MantissaBits;
+	
+	auto bits = bit_cast<Bits>(value);
+	auto sign = static_cast<uint16_t>(bits >> (sizeof(bits) * CHAR_BIT - 16)) &
+		uint16_t{0x8000};
+	auto source_exponent = static_cast<int>(bits >> source_mantissa_bits) &
+		source_max_exponent;
+	Bits mantissa = bits & ((Bits{1} << source_mantissa_bits) - 1);
+	if (source_exponent == source_max_exponent)
+	{
+		if (mantissa == 0)
+		{
+			return sign | infinity;
+		}
+		// Keep the top of the payload and make sure the result stays NaN.
+		return sign | infinity | (1 << (MantissaBits - 1)) |
+			static_cast<uint16_t>(mantissa >> shift);
+	}
+	int exponent = max(source_exponent, 1) - source_bias + bias;
+	if (exponent >= max_exponent)
+	{
+		return sign | infinity;
+	}
+	if ((exponent <= 0) || (source_exponent == 0))
+	{
+		// Result is subnormal. Rounding may carry into the smallest normal
+		// number which is encoded correctly by the same bits.
+		if (source_exponent != 0)
+		{
+			mantissa |= Bits{1} << source_mantissa_bits;
+		}
+		return sign | static_cast<uint16_t>(RoundingShift(mantissa,
+			shift + 1 - exponent));
+	}
+	// Rounding may carry into the exponent which is encoded correctly by the
+	// same addition, including overflow to infinity.
+	return sign | static_cast<uint16_t>((Bits(exponent) << MantissaBits) +
+		RoundingShift(mantissa, shift));
+}
+
+template <iso60559_sane T, int ExponentBits, int MantissaBits>
+constexpr T WidenFloat(uint16_t value) noexcept
+{
+	using Bits = FloatBits<T>;
+	constexpr int target_mantissa_bits = numeric_limits<T>::digits - 1;
+	constexpr int target_bias = numeric_limits<T>::max_exponent - 1;
+	constexpr int target_max_exponent = 2 * target_bias + 1;
+	constexpr int bias = (1 << (ExponentBits - 1)) - 1;
+	constexpr int max_exponent = 2 * bias + 1;
+	constexpr int shift = target_mantissa_bits - MantissaBits;
+	
+	auto sign = Bits(value & 0x8000) << (sizeof(Bits) * CHAR_BIT - 16);
+	int exponent = (value >> MantissaBits) & max_exponent;
+	auto mantissa = Bits(value & ((1 << MantissaBits) - 1)) << shift;
+	Bits bits;
+	if (exponent == max_exponent)
+	{
+		bits = sign | (Bits(target_max_exponent) << target_mantissa_bits) |
+			mantissa;
+		if (mantissa != 0)
+		{
+			bits |= Bits{1} << (target_mantissa_bits - 1);
+		}
+	}
+	else if (exponent == 0)
+	{
+		// Normalize subnormal value if the target has enough exponent range.
+		int target_exponent = 1 - bias + target_bias;
+		while ((mantissa != 0) &&
+			(mantissa < (Bits{1} << target_mantissa_bits)) &&
+			(target_exponent > 1))
+		{
+			mantissa <<= 1;
+			--target_exponent;
+		}
+		if (mantissa >= (Bits{1} << target_mantissa_bits))
+		{
+			bits = sign | (Bits(target_exponent) << target_mantissa_bits) |
+				(mantissa & ((Bits{1} << target_mantissa_bits) - 1));
+		}
+		else
+		{
+			bits = sign | mantissa;
+		}
+	}
+	else
+	{
+		bits = sign | (Bits(exponent - bias + target_bias) <<
+			target_mantissa_bits) | mantissa;
+	}
+	return bit_cast<T>(bits);
+}
+
+constexpr uint16_t NarrowFloat(iso60559_sane auto value,
+	floating_point_format float_format) noexcept
+{
+	if (float_format == floating_point_format::bfloat16)
+	{
+		return NarrowFloat<8, 7>(value);
+	}
+	return NarrowFloat<5, 10>(value);
+}
+
+template <iso60559_sane T>
+constexpr T WidenFloat(uint16_t value, floating_point_format float_format)
+	noexcept
+{
+	if (float_format == floating_point_format::bfloat16)
+	{
+		return WidenFloat<T, 8, 7>(value);
+	}
+	return WidenFloat<T, 5, 10>(value);
+}
+
+template <iso60559_sane T>
+/*constexpr*/ void NarrowFloats(span<const T> in_buffer, format f,
+	span<byte> out_buffer)
+{
+	auto float_format = f.get_floating_point_format();
+	size_t i = 0;
+#if defined(__F16C__)
+	if constexpr (iso60559_binary32<T>)
+	{
+		if ((float_format == floating_point_format::binary16) &&
+			(f.get_endianness() == endian::little) &&
+			(endian::native == endian::little))
+		{
+			// Hardware conversion uses the same rounding as NarrowFloat.
+			for (; i + 8 <= in_buffer.size(); i += 8)
+			{
+				auto values = _mm256_loadu_ps(ranges::data(in_buffer) + i);
+				auto halves = _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(
+					ranges::data(out_buffer) + 2 * i), halves);
+			}
+		}
+	}
+#endif
+	for (; i < in_buffer.size(); ++i)
+	{
+		FromNative(NarrowFloat(in_buffer[i], float_format), f,
+			out_buffer.subspan(2 * i, 2));
+	}
+}
+
+template <iso60559_sane T>
+/*constexpr*/ void WidenFloats(span<const byte> in_buffer, format f,
+	span<T> out_buffer)
+{
+	auto float_format = f.get_floating_point_format();
+	size_t i = 0;
+#if defined(__F16C__)
+	if constexpr (iso60559_binary32<T>)
+	{
+		if ((float_format == floating_point_format::binary16) &&
+			(f.get_endianness() == endian::little) &&
+			(endian::native == endian::little))
+		{
+			for (; i + 8 <= out_buffer.size(); i += 8)
+			{
+				auto halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+					ranges::data(in_buffer) + 2 * i));
+				_mm256_storeu_ps(ranges::data(out_buffer) + i,
+					_mm256_cvtph_ps(halves));
+			}
+		}
+	}
+#endif
+	for (; i < out_buffer.size(); ++i)
+	{
+		uint16_t value;
+		ToNative(in_buffer.subspan(2 * i, 2), f, value);
+		out_buffer[i] = WidenFloat<T>(value, float_format);
+	}
+}
+
+}
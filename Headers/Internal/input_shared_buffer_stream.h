@@ -0,0 +1,38 @@
+/// \file
+/// \brief Internal header file that describes the input_shared_buffer_stream
+/// class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include "position_helper.h"
+#include "shared_buffer.h"
+
+namespace std::io
+{
+
+/// \brief Input memory stream that reads from shared_buffer and keeps it
+/// alive.
+
+class input_shared_buffer_stream final :
+	public PositionHelper<input_shared_buffer_stream, ptrdiff_t>
+{
+public:
+	// Constructors
+	input_shared_buffer_stream() noexcept = default;
+	explicit input_shared_buffer_stream(shared_buffer buffer) noexcept;
+	
+	// Reading
+	streamsize read_some(span<byte> buffer);
+	shared_buffer read_slice(size_t count);
+	
+	// Buffer management
+	const shared_buffer& get_buffer() const noexcept;
+	void set_buffer(shared_buffer new_buffer) noexcept;
+	void reset_buffer() noexcept;
+private:
+	shared_buffer m_buffer;
+};
+
+}
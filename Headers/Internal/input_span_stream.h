@@ -20,6 +20,12 @@ public:
 	
 	// Reading
 	constexpr streamsize read_some(span<byte> buffer);
+	template <typename T>
+	requires is_trivially_copyable_v<T> && (!is_const_v<T>)
+	span<const T> read_view(size_t count);
+	template <typename T>
+	requires is_trivially_copyable_v<T> && (!is_const_v<T>)
+	span<const T> read_view(size_t count, span<T> storage);
 	
 	// Buffer management
 	constexpr span<const byte> get_buffer() const noexcept;
@@ -21,6 +21,20 @@ constexpr streamsize input_span_stream::read_some(span<byte> buffer)
 	return Utilities::ReadSome(m_buffer, m_position, buffer);
 }
 
+template <typename T>
+requires is_trivially_copyable_v<T> && (!is_const_v<T>)
+span<const T> input_span_stream::read_view(size_t count)
+{
+	return Utilities::ReadView<T>(m_buffer, m_position, count, span<T>{});
+}
+
+template <typename T>
+requires is_trivially_copyable_v<T> && (!is_const_v<T>)
+span<const T> input_span_stream::read_view(size_t count, span<T> storage)
+{
+	return Utilities::ReadView(m_buffer, m_position, count, storage);
+}
+
 constexpr span<const byte> input_span_stream::get_buffer() const noexcept
 {
 	return m_buffer;
@@ -0,0 +1,54 @@
+/// \file
+/// \brief Internal header file that describes the output_overflow_span_stream
+/// class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <concepts>
+#include <span>
+
+namespace std::io
+{
+
+/// \brief Output stream that writes into the span provided by the caller and
+/// asks the overflow function for the next span when the current one is full.
+/// \details Overflow function takes the span of written bytes and returns the
+/// span to continue writing to. It may consume the written bytes and return
+/// the same span or return a different one. Returning empty span makes writing
+/// throw. The destructor doesn't call the overflow function, so only flush
+/// passes on the bytes of the last span.
+/// \tparam Overflow Type of the overflow function.
+
+template <typename Overflow>
+requires invocable<Overflow&, span<byte>> &&
+	convertible_to<invoke_result_t<Overflow&, span<byte>>, span<byte>>
+class output_overflow_span_stream final
+{
+public:
+	// Constructors
+	constexpr output_overflow_span_stream(span<byte> buffer,
+		Overflow overflow);
+	
+	// Writing
+	constexpr streamsize write_some(span<const byte> buffer);
+	constexpr void flush();
+	
+	// Buffer management
+	constexpr span<byte> get_buffer() const noexcept;
+	constexpr span<byte> get_written_bytes() const noexcept;
+	constexpr const Overflow& get_overflow() const noexcept;
+private:
+	/// \brief Passes the written bytes to the overflow function and continues
+	/// with the span it returns.
+	constexpr void CallOverflow();
+	
+	span<byte> m_buffer; ///< Span that is currently written to.
+	size_t m_size; ///< Amount of bytes written to the current span.
+	Overflow m_overflow; ///< Function that provides the next span.
+};
+
+}
+
+#include "output_overflow_span_stream.hpp"
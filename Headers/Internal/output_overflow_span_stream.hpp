@@ -0,0 +1,104 @@
+/// \file
+/// \brief Internal header file that contains implementation of the
+/// output_overflow_span_stream class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "io_error.h"
+#include "stream_utilities.h"
+
+namespace std::io
+{
+
+template <typename Overflow>
+requires invocable<Overflow&, span<byte>> &&
+	convertible_to<invoke_result_t<Overflow&, span<byte>>, span<byte>>
+constexpr output_overflow_span_stream<Overflow>::output_overflow_span_stream(
+	span<byte> buffer, Overflow overflow)
+	: m_buffer{buffer},
+	m_size{0},
+	m_overflow{move(overflow)}
+{
+}
+
+template <typename Overflow>
+requires invocable<Overflow&, span<byte>> &&
+	convertible_to<invoke_result_t<Overflow&, span<byte>>, span<byte>>
+constexpr streamsize output_overflow_span_stream<Overflow>::write_some(
+	span<const byte> buffer)
+{
+	if (buffer.empty())
+	{
+		return 0;
+	}
+	if (m_size == m_buffer.size())
+	{
+		this->CallOverflow();
+		if (m_buffer.empty())
+		{
+			throw io_error{"write_some", io_errc::file_too_large};
+		}
+	}
+	auto bytes_to_write = min({buffer.size(), m_buffer.size() - m_size,
+		static_cast<size_t>(numeric_limits<streamsize>::max())});
+	Utilities::CopyBytes(buffer.data(), bytes_to_write,
+		m_buffer.data() + m_size);
+	m_size += bytes_to_write;
+	return static_cast<streamsize>(bytes_to_write);
+}
+
+template <typename Overflow>
+requires invocable<Overflow&, span<byte>> &&
+	convertible_to<invoke_result_t<Overflow&, span<byte>>, span<byte>>
+constexpr void output_overflow_span_stream<Overflow>::flush()
+{
+	if (m_size != 0)
+	{
+		this->CallOverflow();
+	}
+}
+
+template <typename Overflow>
+requires invocable<Overflow&, span<byte>> &&
+	convertible_to<invoke_result_t<Overflow&, span<byte>>, span<byte>>
+constexpr span<byte> output_overflow_span_stream<Overflow>::get_buffer() const
+	noexcept
+{
+	return m_buffer;
+}
+
+template <typename Overflow>
+requires invocable<Overflow&, span<byte>> &&
+	convertible_to<invoke_result_t<Overflow&, span<byte>>, span<byte>>
+constexpr span<byte> output_overflow_span_stream<Overflow>::
+	get_written_bytes() const noexcept
+{
+	return m_buffer.first(m_size);
+}
+
+template <typename Overflow>
+requires invocable<Overflow&, span<byte>> &&
+	convertible_to<invoke_result_t<Overflow&, span<byte>>, span<byte>>
+constexpr const Overflow& output_overflow_span_stream<Overflow>::
+	get_overflow() const noexcept
+{
+	return m_overflow;
+}
+
+template <typename Overflow>
+requires invocable<Overflow&, span<byte>> &&
+	convertible_to<invoke_result_t<Overflow&, span<byte>>, span<byte>>
+constexpr void output_overflow_span_stream<Overflow>::CallOverflow()
+{
+	span<byte> new_buffer = invoke(m_overflow, m_buffer.first(m_size));
+	m_buffer = new_buffer;
+	m_size = 0;
+}
+
+}
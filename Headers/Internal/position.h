@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "offset.h"
 
 namespace std::io
@@ -39,6 +39,11 @@ private:
 	/// \return Moved position.
 	/// \throw std::io::io_error If resulting position is too large.
 	static constexpr position MovePosition(Position pos, offset off);
+	
+	/// \brief Returns the size of the stream. Streams that don't provide
+	/// get_size member function are sized by their buffer.
+	/// \return Size of the stream.
+	constexpr Position GetStreamSize() const noexcept;
 };
 
 }
@@ -62,13 +62,13 @@ constexpr void PositionHelper<Stream, Position>::seek_position(
 		}
 		case base_position::end:
 		{
-			const auto& buffer = static_cast<Stream*>(this)->get_buffer();
+			auto size = GetStreamSize();
 			if constexpr (sizeof(Position) <= sizeof(streamoff))
 			{
-				m_position = ranges::ssize(buffer);
+				m_position = size;
 				return;
 			}
-			m_position = min(ranges::ssize(buffer), position::max().value());
+			m_position = min<Position>(size, position::max().value());
 			return;
 		}
 		default:
@@ -96,8 +96,7 @@ constexpr void PositionHelper<Stream, Position>::seek_position(
 		}
 		case base_position::end:
 		{
-			const auto& buffer = static_cast<Stream*>(this)->get_buffer();
-			this->seek_position(MovePosition(ranges::ssize(buffer), off));
+			this->seek_position(MovePosition(GetStreamSize(), off));
 			return;
 		}
 		default:
@@ -132,4 +131,19 @@ constexpr position PositionHelper<Stream, Position>::MovePosition(Position pos,
 	return position{result};
 }
 
+template <typename Stream, typename Position>
+constexpr Position PositionHelper<Stream, Position>::GetStreamSize() const
+	noexcept
+{
+	const auto& stream = *static_cast<const Stream*>(this);
+	if constexpr (requires { stream.get_size(); })
+	{
+		return static_cast<Position>(stream.get_size());
+	}
+	else
+	{
+		return static_cast<Position>(ranges::ssize(stream.get_buffer()));
+	}
+}
+
 }
@@ -5,7 +5,17 @@
 
 #pragma once
 
+#include <array>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
 #include "context_concepts.h"
+#include "aggregate_utilities.h"
+#include "encoding_policy.h"
 
 namespace std::io
 {
@@ -45,9 +55,53 @@ constexpr void read(R&& r, input_context auto& ctx);
 
 constexpr void read(bool& object, input_context auto& ctx);
 
-/*constexpr*/ void read(integral auto& object, input_context auto& ctx);
+constexpr void read(integral auto& object, input_context auto& ctx);
+
+template <typename T>
+requires integral<T> && (!same_as<T, bool>)
+/*constexpr*/ void read(span<T> buffer, input_context auto& ctx);
+
+template <typename T, typename C>
+requires input_context<C> && Utilities::reflectable_aggregate<T> &&
+	(!CustomlyReadableFrom<T, C>)
+/*constexpr*/ void read(T& object, C& ctx);
+
+template <floating_point T>
+/*constexpr*/ void read(span<T> buffer, input_context auto& ctx);
+
+template <typename T, typename C>
+requires input_context<C> && Utilities::reflectable_aggregate<T> &&
+	(!CustomlyReadableFrom<T, C>)
+/*constexpr*/ void read(span<T> buffer, C& ctx);
+
+template <typename CharT, typename Traits, typename Allocator>
+/*constexpr*/ void read(basic_string<CharT, Traits, Allocator>& object,
+	input_context auto& ctx);
+
+template <typename T, typename Allocator>
+requires (!same_as<T, byte>) && (!same_as<T, bool>)
+/*constexpr*/ void read(vector<T, Allocator>& object, input_context auto& ctx);
+
+template <typename T, size_t N>
+requires (!same_as<T, byte>)
+/*constexpr*/ void read(array<T, N>& object, input_context auto& ctx);
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+/*constexpr*/ void read(map<Key, T, Compare, Allocator>& object,
+	input_context auto& ctx);
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+	typename Allocator>
+/*constexpr*/ void read(unordered_map<Key, T, Hash, KeyEqual, Allocator>& object,
+	input_context auto& ctx);
+
+template <typename T>
+/*constexpr*/ void read(optional<T>& object, input_context auto& ctx);
 
-/*constexpr*/ void read(floating_point auto& object, input_context auto& ctx);
+template <typename... Types>
+/*constexpr*/ void read(variant<Types...>& object, input_context auto& ctx);
+
+constexpr void read(floating_point auto& object, input_context auto& ctx);
 
 struct ReadCustomizationPoint
 {
@@ -60,6 +114,56 @@ struct ReadCustomizationPoint
 
 inline constexpr CustomizationPoints::ReadCustomizationPoint read;
 
+namespace Utilities
+{
+
+/// \brief Reads the length prefix of the container using the length prefix
+/// width of the context format.
+/// \param[in,out] ctx Context to read from.
+/// \return Length read.
+/// \throw std::io::io_error If length doesn't fit into std::size_t.
+constexpr size_t ReadLength(input_context auto& ctx);
+
+/// \brief Reads the object nested in another object. Byte containers are
+/// read with the length prefix, other objects are read as usual.
+/// \param[out] object Object to read.
+/// \param[in,out] ctx Context to read from.
+template <typename T>
+constexpr void ReadElement(T& object, input_context auto& ctx);
+
+/// \brief Accounts the container of the given length against the limits of
+/// the context. Does nothing if context has no limits.
+/// \tparam T Type of the container elements.
+/// \param[in,out] ctx Context to consult.
+/// \param[in] count Amount of elements about to be allocated.
+/// \throw std::io::io_error If limits are exceeded.
+template <typename T>
+constexpr void ReserveElements(input_context auto& ctx, size_t count);
+
+/// \brief Scope guard that tracks nesting of containers in the limits of the
+/// context.
+/// \tparam C Type of the context.
+
+template <input_context C>
+class NestingGuard final
+{
+public:
+	/// \brief Enters one level of nesting.
+	/// \param[in,out] ctx Context to track nesting in.
+	/// \throw std::io::io_error If maximum nesting is exceeded.
+	constexpr NestingGuard(C& ctx);
+	
+	/// \brief Leaves one level of nesting.
+	constexpr ~NestingGuard();
+	
+	NestingGuard(const NestingGuard&) = delete;
+	NestingGuard& operator=(const NestingGuard&) = delete;
+private:
+	C& m_context; ///< Context to track nesting in.
+};
+
+}
+
 template <typename T, typename I, typename... Args>
 concept readable_from =
 	(input_stream<I> || input_context<I>) &&
@@ -8,6 +8,8 @@
 
 #include "read_raw.h"
 #include "format_utilities.h"
+#include "varint_utilities.h"
+#include "delta_utilities.h"
 
 namespace std::io
 {
@@ -69,20 +71,336 @@ constexpr void read(bool& object, input_context auto& ctx)
 	object = integer_value;
 }
 
-/*constexpr*/ void read(integral auto& object, input_context auto& ctx)
+constexpr void read(integral auto& object, input_context auto& ctx)
 {
+	using T = remove_reference_t<decltype(object)>;
+	Utilities::SkipPadding<T>(ctx);
+	if constexpr (sizeof(object) > 1)
+	{
+		if (Utilities::GetIntegerFormat<T>(ctx) != integer_format::fixed)
+		{
+			object = Utilities::FromVarint<T>(
+				Utilities::ReadLEB128<Utilities::VarintType<T>>(
+				ctx.get_stream()));
+			return;
+		}
+	}
 	array<byte, sizeof(object)> buffer;
 	read(buffer, ctx);
 	Utilities::ToNative(buffer, ctx.get_format(), object);
 }
 
-/*constexpr*/ void read(floating_point auto& object, input_context auto& ctx)
+template <typename T>
+requires integral<T> && (!same_as<T, bool>)
+/*constexpr*/ void read(span<T> buffer, input_context auto& ctx)
 {
-	array<byte, sizeof(object)> buffer;
-	read(buffer, ctx);
+	Utilities::SkipPadding<T>(ctx);
+	auto f = ctx.get_format();
+	auto int_format = Utilities::GetIntegerFormat<T>(ctx);
+	if ((sizeof(T) == 1) || (int_format == integer_format::fixed))
+	{
+		// Read everything at once and fix byte order in place.
+		read(as_writable_bytes(buffer), ctx);
+		if ((sizeof(T) == 1) || (f.get_endianness() == endian::native))
+		{
+			return;
+		}
+		for (auto& element : buffer)
+		{
+			Utilities::SwapBytes(f.get_endianness(),
+				as_writable_bytes(span<T, 1>{&element, 1}));
+		}
+		return;
+	}
+	if constexpr (sizeof(T) == sizeof(uint32_t))
+	{
+		if (int_format == integer_format::group_varint)
+		{
+			Utilities::ReadGroupVarintValues(ctx.get_stream(), buffer);
+			return;
+		}
+	}
+	if constexpr (sizeof(T) == sizeof(uint64_t))
+	{
+		if (int_format == integer_format::delta_bit_packed)
+		{
+			array<byte, Utilities::DeltaBlockSize * sizeof(uint64_t) +
+				Utilities::UnpackBitsPadding> data{};
+			array<uint64_t, Utilities::DeltaBlockSize> values;
+			uint64_t previous = 0;
+			while (!buffer.empty())
+			{
+				auto count = min(buffer.size(), values.size());
+				auto minimum = Utilities::ReadLEB128<uint64_t>(
+					ctx.get_stream());
+				uint8_t width;
+				read(width, ctx);
+				if (width > 64)
+				{
+					throw io_error{"read", io_errc::invalid_argument};
+				}
+				auto block = span<uint64_t>{values}.first(count);
+				if (width == 0)
+				{
+					ranges::fill(block, 0);
+				}
+				else
+				{
+					auto size = Utilities::GetPackedSize(count, width);
+					read(span<byte>{data}.first(size), ctx);
+					Utilities::UnpackBits(span<const byte>{data}, 0, width,
+						block);
+				}
+				Utilities::DecodeDeltas(block, minimum, previous);
+				previous = block.back();
+				for (size_t i = 0; i < count; ++i)
+				{
+					buffer[i] = static_cast<T>(values[i]);
+				}
+				buffer = buffer.subspan(count);
+			}
+			return;
+		}
+	}
+	Utilities::ReadLEB128Values(ctx.get_stream(), buffer);
+}
+
+constexpr void read(floating_point auto& object, input_context auto& ctx)
+{
+	using T = remove_reference_t<decltype(object)>;
+	Utilities::SkipPadding<T>(ctx);
+	auto size = Utilities::GetFloatingPointSize<T>(ctx.get_format());
+	array<byte, Utilities::MaxFloatingPointSize<T>> buffer;
+	read(span<byte>{buffer}.first(size), ctx);
 	Utilities::ToNative(buffer, ctx.get_format(), object);
 }
 
+template <floating_point T>
+/*constexpr*/ void read(span<T> buffer, input_context auto& ctx)
+{
+	Utilities::SkipPadding<T>(ctx);
+	if constexpr (Utilities::bitwise_serializable<T>)
+	{
+		if (Utilities::IsNativeRepresentation<T>(ctx))
+		{
+			read(as_writable_bytes(buffer), ctx);
+			return;
+		}
+	}
+	if constexpr (Utilities::iso60559_sane<T>)
+	{
+		// Convert in chunks so that the stream is called once per chunk.
+		auto f = ctx.get_format();
+		auto size = Utilities::GetFloatingPointSize<T>(f);
+		array<byte, 4096> chunk;
+		while (!buffer.empty())
+		{
+			auto count = min(buffer.size(), chunk.size() / size);
+			auto bytes = span<byte>{chunk}.first(size * count);
+			read(bytes, ctx);
+			Utilities::ToNativeFloats(span<const byte>{bytes}, f,
+				buffer.first(count));
+			buffer = buffer.subspan(count);
+		}
+	}
+	else
+	{
+		for (auto& element : buffer)
+		{
+			read(element, ctx);
+		}
+	}
+}
+
+template <typename T, typename C>
+requires input_context<C> && Utilities::reflectable_aggregate<T> &&
+	(!CustomlyReadableFrom<T, C>)
+/*constexpr*/ void read(T& object, C& ctx)
+{
+	Utilities::SkipPadding<T>(ctx);
+	if constexpr (Utilities::bitwise_serializable<T>)
+	{
+		if (Utilities::IsNativeRepresentation<T>(ctx))
+		{
+			read(as_writable_bytes(span<T, 1>{&object, 1}), ctx);
+			return;
+		}
+	}
+	Utilities::ForEachField(object, [&](auto& field)
+	{
+		Utilities::ReadElement(field, ctx);
+	});
+}
+
+template <typename T, typename C>
+requires input_context<C> && Utilities::reflectable_aggregate<T> &&
+	(!CustomlyReadableFrom<T, C>)
+/*constexpr*/ void read(span<T> buffer, C& ctx)
+{
+	Utilities::SkipPadding<T>(ctx);
+	if constexpr (Utilities::bitwise_serializable<T>)
+	{
+		if (Utilities::IsNativeRepresentation<T>(ctx))
+		{
+			read(as_writable_bytes(buffer), ctx);
+			return;
+		}
+	}
+	for (auto& element : buffer)
+	{
+		read(element, ctx);
+	}
+}
+
+template <typename CharT, typename Traits, typename Allocator>
+/*constexpr*/ void read(basic_string<CharT, Traits, Allocator>& object,
+	input_context auto& ctx)
+{
+	using C = remove_reference_t<decltype(ctx)>;
+	if constexpr (Utilities::GetStringEncoding<CharT, C>() ==
+		string_encoding::null_terminated)
+	{
+		object.clear();
+		for (;;)
+		{
+			CharT character;
+			read(character, ctx);
+			if (character == CharT{})
+			{
+				return;
+			}
+			if constexpr (limited_context<C>)
+			{
+				// Length is not known up front so check the running total.
+				if (object.size() >= ctx.get_limits().get_max_elements())
+				{
+					throw io_error{"read", io_errc::value_too_large};
+				}
+			}
+			Utilities::ReserveElements<CharT>(ctx, 1);
+			object.push_back(character);
+		}
+	}
+	else
+	{
+		auto length = Utilities::ReadLength(ctx);
+		Utilities::ReserveElements<CharT>(ctx, length);
+		object.resize(length);
+		span<CharT> buffer{object};
+		read(buffer, ctx);
+	}
+}
+
+template <typename T, typename Allocator>
+requires (!same_as<T, byte>) && (!same_as<T, bool>)
+/*constexpr*/ void read(vector<T, Allocator>& object, input_context auto& ctx)
+{
+	Utilities::NestingGuard guard{ctx};
+	auto length = Utilities::ReadLength(ctx);
+	Utilities::ReserveElements<T>(ctx, length);
+	// Allocate once and then fill in place so that arrays of bitwise
+	// serializable elements are read with a single call.
+	object.resize(length);
+	span<T> buffer{object};
+	if constexpr (requires { read(buffer, ctx); })
+	{
+		read(buffer, ctx);
+	}
+	else
+	{
+		for (auto& element : object)
+		{
+			Utilities::ReadElement(element, ctx);
+		}
+	}
+}
+
+template <typename T, size_t N>
+requires (!same_as<T, byte>)
+/*constexpr*/ void read(array<T, N>& object, input_context auto& ctx)
+{
+	// Size is known statically so there is no length prefix.
+	span<T> buffer{object};
+	if constexpr (requires { read(buffer, ctx); })
+	{
+		read(buffer, ctx);
+	}
+	else
+	{
+		for (auto& element : object)
+		{
+			Utilities::ReadElement(element, ctx);
+		}
+	}
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+/*constexpr*/ void read(map<Key, T, Compare, Allocator>& object,
+	input_context auto& ctx)
+{
+	Utilities::NestingGuard guard{ctx};
+	auto length = Utilities::ReadLength(ctx);
+	Utilities::ReserveElements<pair<const Key, T>>(ctx, length);
+	object.clear();
+	for (size_t i = 0; i < length; ++i)
+	{
+		Key key;
+		T value;
+		Utilities::ReadElement(key, ctx);
+		Utilities::ReadElement(value, ctx);
+		// Keys are written in order so hint at the end avoids searching.
+		object.emplace_hint(object.end(), move(key), move(value));
+	}
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+	typename Allocator>
+/*constexpr*/ void read(unordered_map<Key, T, Hash, KeyEqual, Allocator>& object,
+	input_context auto& ctx)
+{
+	Utilities::NestingGuard guard{ctx};
+	auto length = Utilities::ReadLength(ctx);
+	Utilities::ReserveElements<pair<const Key, T>>(ctx, length);
+	object.clear();
+	object.reserve(length);
+	for (size_t i = 0; i < length; ++i)
+	{
+		Key key;
+		T value;
+		Utilities::ReadElement(key, ctx);
+		Utilities::ReadElement(value, ctx);
+		object.emplace(move(key), move(value));
+	}
+}
+
+template <typename T>
+/*constexpr*/ void read(optional<T>& object, input_context auto& ctx)
+{
+	bool has_value;
+	read(has_value, ctx);
+	if (!has_value)
+	{
+		object.reset();
+		return;
+	}
+	Utilities::ReadElement(object.emplace(), ctx);
+}
+
+template <typename... Types>
+/*constexpr*/ void read(variant<Types...>& object, input_context auto& ctx)
+{
+	auto index = Utilities::ReadLength(ctx);
+	if (index >= sizeof...(Types))
+	{
+		throw io_error{"read", io_errc::invalid_argument};
+	}
+	[&]<size_t... I>(index_sequence<I...>)
+	{
+		((index == I ? (Utilities::ReadElement(object.template emplace<I>(),
+			ctx), true) : false) || ...);
+	}(index_sequence_for<Types...>{});
+}
+
 template <typename I, typename... Args>
 requires input_stream<I> || input_context<I>
 constexpr void ReadCustomizationPoint::operator()(auto& object, I& i,
@@ -91,5 +409,92 @@ constexpr void ReadCustomizationPoint::operator()(auto& object, I& i,
 	read(object, i, forward<Args>(args)...);
 }
 
+}
+
+namespace Utilities
+{
+
+constexpr size_t ReadLength(input_context auto& ctx)
+{
+	uint_least64_t length;
+	switch (Utilities::GetLengthPrefixWidth(ctx))
+	{
+		case length_prefix_width::one_byte:
+		{
+			uint8_t value;
+			io::read(value, ctx);
+			length = value;
+			break;
+		}
+		case length_prefix_width::two_bytes:
+		{
+			uint16_t value;
+			io::read(value, ctx);
+			length = value;
+			break;
+		}
+		case length_prefix_width::four_bytes:
+		{
+			uint32_t value;
+			io::read(value, ctx);
+			length = value;
+			break;
+		}
+		default:
+		{
+			uint64_t value;
+			io::read(value, ctx);
+			length = value;
+			break;
+		}
+	}
+	if (length > numeric_limits<size_t>::max())
+	{
+		throw io_error{"ReadLength", io_errc::value_too_large};
+	}
+	return static_cast<size_t>(length);
+}
+
+template <typename T>
+constexpr void ReadElement(T& object, input_context auto& ctx)
+{
+	if constexpr (byte_container<T>)
+	{
+		NestingGuard guard{ctx};
+		auto length = Utilities::ReadLength(ctx);
+		Utilities::ReserveElements<byte>(ctx, length);
+		object.resize(length);
+	}
+	io::read(object, ctx);
+}
+
+template <typename T>
+constexpr void ReserveElements(input_context auto& ctx, size_t count)
+{
+	if constexpr (limited_context<remove_reference_t<decltype(ctx)>>)
+	{
+		ctx.get_limits().reserve(count, sizeof(T));
+	}
+}
+
+template <input_context C>
+constexpr NestingGuard<C>::NestingGuard(C& ctx)
+	: m_context{ctx}
+{
+	if constexpr (limited_context<C>)
+	{
+		m_context.get_limits().enter();
+	}
+}
+
+template <input_context C>
+constexpr NestingGuard<C>::~NestingGuard()
+{
+	if constexpr (limited_context<C>)
+	{
+		m_context.get_limits().leave();
+	}
+}
+
 }
 }
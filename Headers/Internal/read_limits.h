@@ -0,0 +1,53 @@
+/// \file
+/// \brief Internal header file that describes the read_limits class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+namespace std::io
+{
+
+/// \brief Limits on the resources that reading from untrusted input may
+/// consume.
+/// \details Read overloads of containers consult the limits of the context
+/// before allocating so that forged lengths fail instead of exhausting memory.
+/// Usage is accumulated until reset.
+
+class read_limits final
+{
+public:
+	// Constructor
+	constexpr read_limits(size_t max_bytes = numeric_limits<size_t>::max(),
+		size_t max_elements = numeric_limits<size_t>::max(),
+		size_t max_depth = numeric_limits<size_t>::max()) noexcept;
+	
+	// Limits
+	constexpr size_t get_max_bytes() const noexcept;
+	constexpr void set_max_bytes(size_t new_max) noexcept;
+	constexpr size_t get_max_elements() const noexcept;
+	constexpr void set_max_elements(size_t new_max) noexcept;
+	constexpr size_t get_max_depth() const noexcept;
+	constexpr void set_max_depth(size_t new_max) noexcept;
+	
+	// Usage
+	constexpr size_t get_allocated_bytes() const noexcept;
+	constexpr size_t get_depth() const noexcept;
+	constexpr void reserve(size_t count, size_t element_size);
+	constexpr void enter();
+	constexpr void leave() noexcept;
+	constexpr void reset() noexcept;
+private:
+	size_t m_max_bytes; ///< Maximum total amount of bytes to allocate.
+	size_t m_max_elements; ///< Maximum amount of elements in one container.
+	size_t m_max_depth; ///< Maximum nesting of containers.
+	size_t m_allocated_bytes; ///< Total amount of bytes allocated so far.
+	size_t m_depth; ///< Current nesting of containers.
+};
+
+}
+
+#include "read_limits.hpp"
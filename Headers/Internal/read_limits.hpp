@@ -0,0 +1,102 @@
+/// \file
+/// \brief Internal header file that contains implementation of the
+/// read_limits class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include "io_error.h"
+
+namespace std::io
+{
+
+constexpr read_limits::read_limits(size_t max_bytes, size_t max_elements,
+	size_t max_depth) noexcept
+	: m_max_bytes{max_bytes},
+	m_max_elements{max_elements},
+	m_max_depth{max_depth},
+	m_allocated_bytes{0},
+	m_depth{0}
+{
+}
+
+constexpr size_t read_limits::get_max_bytes() const noexcept
+{
+	return m_max_bytes;
+}
+
+constexpr void read_limits::set_max_bytes(size_t new_max) noexcept
+{
+	m_max_bytes = new_max;
+}
+
+constexpr size_t read_limits::get_max_elements() const noexcept
+{
+	return m_max_elements;
+}
+
+constexpr void read_limits::set_max_elements(size_t new_max) noexcept
+{
+	m_max_elements = new_max;
+}
+
+constexpr size_t read_limits::get_max_depth() const noexcept
+{
+	return m_max_depth;
+}
+
+constexpr void read_limits::set_max_depth(size_t new_max) noexcept
+{
+	m_max_depth = new_max;
+}
+
+constexpr size_t read_limits::get_allocated_bytes() const noexcept
+{
+	return m_allocated_bytes;
+}
+
+constexpr size_t read_limits::get_depth() const noexcept
+{
+	return m_depth;
+}
+
+constexpr void read_limits::reserve(size_t count, size_t element_size)
+{
+	if (count > m_max_elements)
+	{
+		throw io_error{"reserve", io_errc::value_too_large};
+	}
+	// Written as division so that forged counts can't overflow the product.
+	auto bytes_left = m_max_bytes - min(m_allocated_bytes, m_max_bytes);
+	if ((element_size != 0) && (count > bytes_left / element_size))
+	{
+		throw io_error{"reserve", io_errc::value_too_large};
+	}
+	m_allocated_bytes += count * element_size;
+}
+
+constexpr void read_limits::enter()
+{
+	if (m_depth >= m_max_depth)
+	{
+		throw io_error{"enter", io_errc::value_too_large};
+	}
+	++m_depth;
+}
+
+constexpr void read_limits::leave() noexcept
+{
+	if (m_depth > 0)
+	{
+		--m_depth;
+	}
+}
+
+constexpr void read_limits::reset() noexcept
+{
+	m_allocated_bytes = 0;
+	m_depth = 0;
+}
+
+}
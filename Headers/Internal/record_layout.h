@@ -0,0 +1,119 @@
+/// \file
+/// \brief Internal header file that describes the record_field and
+/// record_layout class templates.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "stream_concepts.h"
+#include "format_utilities.h"
+#include "aggregate_utilities.h"
+
+namespace std::io
+{
+
+namespace Utilities
+{
+
+/// \brief A concept specifying a type that can be a field of a fixed-layout
+/// record.
+template <typename T>
+concept record_value = integral<T> || is_enum_v<T> || same_as<T, byte> ||
+	iso60559_sane<T>;
+
+/// \brief Returns the offset of the field of the record where fields of the
+/// given types are stored consecutively without padding.
+/// \tparam Types Types of all fields.
+/// \param[in] index Index of the field. Index equal to the amount of fields
+/// gives the size of the record.
+/// \return Offset of the field in bytes.
+template <typename... Types>
+consteval size_t GetPackedOffset(size_t index) noexcept;
+
+/// \brief Builds the record_layout of the aggregate stored without padding.
+/// \tparam Fields Tuple of references to the fields of the aggregate.
+/// \tparam Endianness Endianness of the fields.
+/// \tparam Indices Index sequence of the fields.
+template <typename Fields, endian Endianness,
+	typename Indices = make_index_sequence<tuple_size_v<Fields>>>
+struct PackedRecordLayout;
+
+}
+
+/// \brief Describes a field of a fixed-layout record.
+/// \details Integers and enumerations are stored as fixed-width two's
+/// complement values, floating point values are stored in ISO 60559 format.
+/// \tparam T Type of the field value.
+/// \tparam Offset Offset of the field from the start of the record in bytes.
+/// \tparam Endianness Endianness of the field.
+
+template <Utilities::record_value T, size_t Offset,
+	endian Endianness = endian::native>
+struct record_field final
+{
+	using value_type = T;
+	static constexpr size_t offset = Offset;
+	static constexpr endian endianness = Endianness;
+	
+	// Conversion
+	static constexpr T decode(span<const byte> record);
+	static constexpr void encode(T value, span<byte> record);
+};
+
+/// \brief Describes the layout of a fixed-size record and decodes records
+/// with it.
+/// \details Whole record is transferred at once and fields are extracted at
+/// constant offsets so that no per-field bounds checks or stream calls are
+/// made. Bytes not covered by fields are ignored on reading and written as
+/// zeroes.
+/// \tparam Size Size of the record in bytes.
+/// \tparam Fields Specializations of record_field.
+
+template <size_t Size, typename... Fields>
+requires (sizeof...(Fields) > 0) &&
+	((Fields::offset + sizeof(typename Fields::value_type) <= Size) && ...)
+class record_layout final
+{
+public:
+	using value_type = tuple<typename Fields::value_type...>;
+	static constexpr size_t size = Size;
+	
+	template <size_t Index>
+	using field = tuple_element_t<Index, tuple<Fields...>>;
+	
+	// Conversion
+	static constexpr value_type decode(span<const byte, Size> record);
+	static constexpr void encode(const value_type& value,
+		span<byte, Size> record);
+	
+	template <size_t Index>
+	static constexpr auto get(span<const byte, Size> record);
+	
+	// Reading and writing
+	static constexpr value_type read(input_stream auto& s);
+	static constexpr void write(const value_type& value,
+		output_stream auto& s);
+	static void read_columns(input_stream auto& s,
+		span<typename Fields::value_type>... columns);
+private:
+	/// \brief Amount of records transferred at once by read_columns.
+	static constexpr size_t BatchSize = (Size >= 4096) ? 1 : 4096 / Size;
+};
+
+/// \brief Layout of the aggregate stored field by field without padding, the
+/// same way std::io::write stores it with fixed-width integers and ISO 60559
+/// floating point format.
+/// \tparam T Type of the aggregate. All fields must be integers,
+/// enumerations, bytes or sane ISO 60559 values.
+/// \tparam Endianness Endianness of the fields.
+template <Utilities::reflectable_aggregate T, endian Endianness = endian::native>
+using packed_record_layout = typename Utilities::PackedRecordLayout<
+	decltype(Utilities::TieFields(declval<T&>())), Endianness>::type;
+
+}
+
+#include "record_layout.hpp"
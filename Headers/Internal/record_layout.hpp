@@ -0,0 +1,174 @@
+/// \file
+/// \brief Internal header file that contains implementation of the
+/// record_field and record_layout class templates.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+#include "io_error.h"
+#include "read_raw.h"
+#include "write_raw.h"
+#include "column_utilities.h"
+
+namespace std::io
+{
+
+template <Utilities::record_value T, size_t Offset, endian Endianness>
+constexpr T record_field<T, Offset, Endianness>::decode(
+	span<const byte> record)
+{
+	constexpr format f{Endianness, floating_point_format::iec559};
+	auto bytes = record.subspan(Offset, sizeof(T));
+	if constexpr (same_as<T, byte>)
+	{
+		return bytes[0];
+	}
+	else if constexpr (same_as<T, bool>)
+	{
+		return bytes[0] != byte{0};
+	}
+	else if constexpr (is_enum_v<T>)
+	{
+		underlying_type_t<T> value;
+		Utilities::ToNative(bytes, f, value);
+		return static_cast<T>(value);
+	}
+	else
+	{
+		T value;
+		Utilities::ToNative(bytes, f, value);
+		return value;
+	}
+}
+
+template <Utilities::record_value T, size_t Offset, endian Endianness>
+constexpr void record_field<T, Offset, Endianness>::encode(T value,
+	span<byte> record)
+{
+	constexpr format f{Endianness, floating_point_format::iec559};
+	auto bytes = record.subspan(Offset, sizeof(T));
+	if constexpr (same_as<T, byte>)
+	{
+		bytes[0] = value;
+	}
+	else if constexpr (same_as<T, bool>)
+	{
+		bytes[0] = value ? byte{1} : byte{0};
+	}
+	else
+	{
+		Utilities::FromNative(value, f, bytes);
+	}
+}
+
+template <size_t Size, typename... Fields>
+requires (sizeof...(Fields) > 0) &&
+	((Fields::offset + sizeof(typename Fields::value_type) <= Size) && ...)
+constexpr auto record_layout<Size, Fields...>::decode(
+	span<const byte, Size> record) -> value_type
+{
+	return value_type{Fields::decode(record)...};
+}
+
+template <size_t Size, typename... Fields>
+requires (sizeof...(Fields) > 0) &&
+	((Fields::offset + sizeof(typename Fields::value_type) <= Size) && ...)
+constexpr void record_layout<Size, Fields...>::encode(const value_type& value,
+	span<byte, Size> record)
+{
+	ranges::fill(record, byte{0});
+	apply([&](const auto&... field_values)
+	{
+		(Fields::encode(field_values, record), ...);
+	}, value);
+}
+
+template <size_t Size, typename... Fields>
+requires (sizeof...(Fields) > 0) &&
+	((Fields::offset + sizeof(typename Fields::value_type) <= Size) && ...)
+template <size_t Index>
+constexpr auto record_layout<Size, Fields...>::get(
+	span<const byte, Size> record)
+{
+	return field<Index>::decode(record);
+}
+
+template <size_t Size, typename... Fields>
+requires (sizeof...(Fields) > 0) &&
+	((Fields::offset + sizeof(typename Fields::value_type) <= Size) && ...)
+constexpr auto record_layout<Size, Fields...>::read(input_stream auto& s) ->
+	value_type
+{
+	array<byte, Size> record;
+	read_raw(record, s);
+	return decode(record);
+}
+
+template <size_t Size, typename... Fields>
+requires (sizeof...(Fields) > 0) &&
+	((Fields::offset + sizeof(typename Fields::value_type) <= Size) && ...)
+constexpr void record_layout<Size, Fields...>::write(const value_type& value,
+	output_stream auto& s)
+{
+	array<byte, Size> record;
+	encode(value, record);
+	write_raw(span<const byte>{record}, s);
+}
+
+template <size_t Size, typename... Fields>
+requires (sizeof...(Fields) > 0) &&
+	((Fields::offset + sizeof(typename Fields::value_type) <= Size) && ...)
+void record_layout<Size, Fields...>::read_columns(
+	input_stream auto& s, span<typename Fields::value_type>... columns)
+{
+	array<size_t, sizeof...(Fields)> sizes{columns.size()...};
+	auto count = sizes[0];
+	if (ranges::any_of(sizes, [&](size_t column_size)
+		{
+			return column_size != count;
+		}))
+	{
+		throw io_error{"read_columns", io_errc::invalid_argument};
+	}
+	array<byte, BatchSize * Size> buffer;
+	for (size_t first = 0; first < count; first += BatchSize)
+	{
+		auto records = min(BatchSize, count - first);
+		auto bytes = span<byte>{buffer}.first(records * Size);
+		read_raw(bytes, s);
+		// Each column is filled by its own pass over the block.
+		(Utilities::ExtractColumn<Size, Fields>(bytes,
+			columns.subspan(first, records)), ...);
+	}
+}
+
+namespace Utilities
+{
+
+template <typename... Types>
+consteval size_t GetPackedOffset(size_t index) noexcept
+{
+	size_t sizes[] = {sizeof(Types)..., 0};
+	size_t result = 0;
+	for (size_t i = 0; i < index; ++i)
+	{
+		result += sizes[i];
+	}
+	return result;
+}
+
+template <typename... Types, endian Endianness, size_t... Indices>
+struct PackedRecordLayout<tuple<Types&...>, Endianness,
+	index_sequence<Indices...>>
+{
+	using type = record_layout<GetPackedOffset<Types...>(sizeof...(Types)),
+		record_field<Types, GetPackedOffset<Types...>(Indices), Endianness>...>;
+};
+
+}
+
+}
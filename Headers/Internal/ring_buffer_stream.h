@@ -0,0 +1,110 @@
+/// \file
+/// \brief Internal header file that describes the ring_buffer_stream class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <ios>
+#include <span>
+
+namespace std::io
+{
+
+/// \brief Specifies how the memory of the ring buffer is mapped.
+enum class ring_buffer_mapping
+{
+	/// \brief Buffer is mapped once, regions that wrap around are split.
+	single,
+	/// \brief Buffer is mapped twice in a row so that every region is
+	/// contiguous. Only supported on Linux, falls back to single mapping on
+	/// other platforms or if the capacity is not a multiple of the page size.
+	mirrored
+};
+
+/// \brief Specifies what read_some and write_some do when no bytes can be
+/// transferred.
+enum class ring_buffer_mode
+{
+	/// \brief Reading from the empty stream reads 0 bytes and writing to the
+	/// full stream throws io_error. Use try_read and try_write to transfer
+	/// whole values without consuming a part of them.
+	non_blocking,
+	/// \brief Reading from the empty stream waits until the writer writes
+	/// something or closes the stream, writing to the full stream waits until
+	/// the reader reads something. Writing more than the capacity without a
+	/// concurrent reader never returns.
+	blocking
+};
+
+/// \brief Bounded FIFO stream of bytes over the buffer of fixed power-of-two
+/// capacity.
+/// \details One thread may write while another thread reads without locking.
+/// More than one reader or more than one writer at a time is undefined
+/// behavior.
+
+class ring_buffer_stream final
+{
+public:
+	// Construct/copy/destroy
+	explicit ring_buffer_stream(size_t capacity,
+		ring_buffer_mapping mapping = ring_buffer_mapping::single,
+		ring_buffer_mode mode = ring_buffer_mode::non_blocking);
+	ring_buffer_stream(const ring_buffer_stream&) = delete;
+	~ring_buffer_stream();
+	ring_buffer_stream& operator=(const ring_buffer_stream&) = delete;
+	
+	// Reading
+	streamsize read_some(span<byte> buffer);
+	bool try_read(span<byte> buffer);
+	span<const byte> get_readable_bytes() const noexcept;
+	void commit_read(size_t count) noexcept;
+	
+	// Writing
+	streamsize write_some(span<const byte> buffer);
+	bool try_write(span<const byte> buffer);
+	span<byte> get_writable_bytes() const noexcept;
+	void commit_write(size_t count) noexcept;
+	void close() noexcept;
+	bool is_closed() const noexcept;
+	
+	// Capacity
+	size_t get_capacity() const noexcept;
+	size_t get_size() const noexcept;
+	bool is_mirrored() const noexcept;
+	ring_buffer_mode get_mode() const noexcept;
+private:
+	/// \brief Size of the cache line used to keep indices apart.
+	static constexpr size_t CacheLineSize = 64;
+	
+	/// \brief Returns the contiguous region of the buffer that starts at the
+	/// given index.
+	/// \param[in] index Index of the first byte.
+	/// \param[in] count Amount of bytes available starting from the index.
+	/// \return Region of the buffer.
+	span<byte> GetRegion(size_t index, size_t count) const noexcept;
+	
+	/// \brief Reads as many bytes as available without waiting.
+	/// \param[out] buffer Buffer to read into.
+	/// \return Amount of bytes read.
+	size_t ReadAvailable(span<byte> buffer) noexcept;
+	
+	/// \brief Writes as many bytes as there is room for without waiting.
+	/// \param[in] buffer Bytes to write.
+	/// \return Amount of bytes written.
+	size_t WriteAvailable(span<const byte> buffer) noexcept;
+	
+	byte* m_buffer; ///< Memory of the buffer.
+	size_t m_capacity; ///< Capacity of the buffer in bytes.
+	bool m_mirrored; ///< Whether the buffer is mapped twice.
+	ring_buffer_mode m_mode; ///< What to do when no bytes can be transferred.
+	atomic<bool> m_closed; ///< Whether the writer has closed the stream.
+	/// \brief Total amount of bytes read. Only the reader modifies it.
+	alignas(CacheLineSize) atomic<size_t> m_read_index;
+	/// \brief Total amount of bytes written. Only the writer modifies it.
+	alignas(CacheLineSize) atomic<size_t> m_write_index;
+};
+
+}
@@ -0,0 +1,62 @@
+/// \file
+/// \brief Internal header file that describes the shared_buffer class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace std::io
+{
+
+/// \brief Immutable reference-counted sequence of bytes.
+/// \details Copies and slices share the same allocation which is freed when the
+/// last of them is destroyed. Copying and slicing don't copy bytes and are safe
+/// to do from multiple threads. Bytes written to output_memory_stream are
+/// shared without copying via shared_buffer{std::move(stream).get_buffer()}.
+
+class shared_buffer final
+{
+public:
+	using value_type = byte;
+	using size_type = size_t;
+	using difference_type = ptrdiff_t;
+	using const_reference = const byte&;
+	using const_pointer = const byte*;
+	using const_iterator = const byte*;
+	using iterator = const_iterator;
+	
+	// Construct/copy/destroy
+	shared_buffer() noexcept = default;
+	explicit shared_buffer(vector<byte>&& bytes);
+	explicit shared_buffer(span<const byte> bytes);
+	
+	// Iterators
+	const_iterator begin() const noexcept;
+	const_iterator end() const noexcept;
+	
+	// Capacity
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	
+	// Element access
+	const_reference operator[](size_type index) const noexcept;
+	const_pointer data() const noexcept;
+	span<const byte> get_bytes() const noexcept;
+	
+	// Slicing
+	shared_buffer subslice(size_type offset,
+		size_type count = dynamic_extent) const;
+	long get_use_count() const noexcept;
+private:
+	/// \brief Pointer to the first byte that shares ownership of the whole
+	/// allocation.
+	shared_ptr<const byte> m_data;
+	size_type m_size = 0; ///< Amount of bytes in the slice.
+};
+
+}
@@ -0,0 +1,100 @@
+/// \file
+/// \brief Internal header file that describes the small_buffer class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+namespace std::io
+{
+
+/// \brief Contiguous container of bytes that keeps up to N bytes inside the
+/// object and moves them to the heap only when the size exceeds N.
+/// \details Provides the subset of the vector interface that memory streams
+/// use, so that serializing small messages via basic_output_memory_stream
+/// doesn't allocate. Moving a buffer that is still inline copies its bytes.
+/// \tparam N Amount of bytes stored inline.
+
+template <size_t N>
+class small_buffer final
+{
+	static_assert(N > 0, "Inline capacity must not be zero.");
+public:
+	using value_type = byte;
+	using size_type = size_t;
+	using difference_type = ptrdiff_t;
+	using reference = byte&;
+	using const_reference = const byte&;
+	using pointer = byte*;
+	using const_pointer = const byte*;
+	using iterator = byte*;
+	using const_iterator = const byte*;
+	
+	/// \brief Amount of bytes stored inline.
+	static constexpr size_type inline_capacity = N;
+	
+	// Construct/copy/destroy
+	small_buffer() noexcept;
+	small_buffer(const small_buffer& other);
+	small_buffer(small_buffer&& other) noexcept;
+	~small_buffer();
+	small_buffer& operator=(const small_buffer& other);
+	small_buffer& operator=(small_buffer&& other) noexcept;
+	
+	// Iterators
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+	
+	// Capacity
+	bool empty() const noexcept;
+	size_type size() const noexcept;
+	size_type max_size() const noexcept;
+	size_type capacity() const noexcept;
+	void reserve(size_type new_capacity);
+	bool is_inline() const noexcept;
+	
+	// Element access
+	reference operator[](size_type index) noexcept;
+	const_reference operator[](size_type index) const noexcept;
+	pointer data() noexcept;
+	const_pointer data() const noexcept;
+	
+	// Modifiers
+	void clear() noexcept;
+	void resize(size_type count);
+	void resize(size_type count, byte value);
+	void push_back(byte value);
+	iterator insert(const_iterator pos, size_type count, byte value);
+	template <forward_iterator It>
+	requires convertible_to<iter_reference_t<It>, byte>
+	iterator insert(const_iterator pos, It first, It last);
+	
+	// Comparison
+	bool operator==(const small_buffer& other) const noexcept;
+private:
+	/// \brief Makes room for count bytes at the given offset, moving the
+	/// following bytes towards the end.
+	/// \param[in] offset Offset to insert at.
+	/// \param[in] count Amount of bytes to insert.
+	/// \return Pointer to the first inserted byte.
+	/// \throw std::length_error If the size would exceed max_size().
+	/// \throw std::bad_alloc If there was not enough memory.
+	byte* MakeRoom(size_type offset, size_type count);
+	
+	/// \brief Frees heap memory if the bytes are not inline.
+	void Deallocate() noexcept;
+	
+	byte* m_data; ///< Pointer to either inline or heap storage.
+	size_type m_size; ///< Amount of bytes in the buffer.
+	size_type m_capacity; ///< Amount of bytes the storage can hold.
+	byte m_inline_storage[N]; ///< Inline storage, left uninitialized.
+};
+
+}
+
+#include "small_buffer.hpp"
@@ -0,0 +1,289 @@
+/// \file
+/// \brief Internal header file that contains implementation of the
+/// small_buffer class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace std::io
+{
+
+template <size_t N>
+small_buffer<N>::small_buffer() noexcept
+	: m_data{m_inline_storage},
+	m_size{0},
+	m_capacity{N}
+{
+}
+
+template <size_t N>
+small_buffer<N>::small_buffer(const small_buffer& other)
+	: small_buffer{}
+{
+	this->insert(this->end(), other.begin(), other.end());
+}
+
+template <size_t N>
+small_buffer<N>::small_buffer(small_buffer&& other) noexcept
+	: small_buffer{}
+{
+	*this = move(other);
+}
+
+template <size_t N>
+small_buffer<N>::~small_buffer()
+{
+	this->Deallocate();
+}
+
+template <size_t N>
+small_buffer<N>& small_buffer<N>::operator=(const small_buffer& other)
+{
+	if (this == &other)
+	{
+		return *this;
+	}
+	m_size = 0;
+	this->insert(this->end(), other.begin(), other.end());
+	return *this;
+}
+
+template <size_t N>
+small_buffer<N>& small_buffer<N>::operator=(small_buffer&& other) noexcept
+{
+	if (this == &other)
+	{
+		return *this;
+	}
+	if (other.is_inline())
+	{
+		// Inline bytes can't be stolen, keep own storage and copy them.
+		if (other.m_size != 0)
+		{
+			memcpy(m_data, other.m_data, other.m_size);
+		}
+		m_size = other.m_size;
+	}
+	else
+	{
+		this->Deallocate();
+		m_data = other.m_data;
+		m_size = other.m_size;
+		m_capacity = other.m_capacity;
+		other.m_data = other.m_inline_storage;
+		other.m_capacity = N;
+	}
+	other.m_size = 0;
+	return *this;
+}
+
+template <size_t N>
+typename small_buffer<N>::iterator small_buffer<N>::begin() noexcept
+{
+	return m_data;
+}
+
+template <size_t N>
+typename small_buffer<N>::const_iterator small_buffer<N>::begin() const
+	noexcept
+{
+	return m_data;
+}
+
+template <size_t N>
+typename small_buffer<N>::iterator small_buffer<N>::end() noexcept
+{
+	return m_data + m_size;
+}
+
+template <size_t N>
+typename small_buffer<N>::const_iterator small_buffer<N>::end() const
+	noexcept
+{
+	return m_data + m_size;
+}
+
+template <size_t N>
+bool small_buffer<N>::empty() const noexcept
+{
+	return m_size == 0;
+}
+
+template <size_t N>
+typename small_buffer<N>::size_type small_buffer<N>::size() const noexcept
+{
+	return m_size;
+}
+
+template <size_t N>
+typename small_buffer<N>::size_type small_buffer<N>::max_size() const
+	noexcept
+{
+	return static_cast<size_type>(numeric_limits<difference_type>::max());
+}
+
+template <size_t N>
+typename small_buffer<N>::size_type small_buffer<N>::capacity() const
+	noexcept
+{
+	return m_capacity;
+}
+
+template <size_t N>
+void small_buffer<N>::reserve(size_type new_capacity)
+{
+	if (new_capacity <= m_capacity)
+	{
+		return;
+	}
+	if (new_capacity > this->max_size())
+	{
+		throw length_error{"small_buffer::reserve"};
+	}
+	auto new_data = new byte[new_capacity];
+	if (m_size != 0)
+	{
+		memcpy(new_data, m_data, m_size);
+	}
+	this->Deallocate();
+	m_data = new_data;
+	m_capacity = new_capacity;
+}
+
+template <size_t N>
+bool small_buffer<N>::is_inline() const noexcept
+{
+	return m_data == m_inline_storage;
+}
+
+template <size_t N>
+typename small_buffer<N>::reference small_buffer<N>::operator[](
+	size_type index) noexcept
+{
+	return m_data[index];
+}
+
+template <size_t N>
+typename small_buffer<N>::const_reference small_buffer<N>::operator[](
+	size_type index) const noexcept
+{
+	return m_data[index];
+}
+
+template <size_t N>
+typename small_buffer<N>::pointer small_buffer<N>::data() noexcept
+{
+	return m_data;
+}
+
+template <size_t N>
+typename small_buffer<N>::const_pointer small_buffer<N>::data() const
+	noexcept
+{
+	return m_data;
+}
+
+template <size_t N>
+void small_buffer<N>::clear() noexcept
+{
+	m_size = 0;
+}
+
+template <size_t N>
+void small_buffer<N>::resize(size_type count)
+{
+	this->resize(count, byte{0});
+}
+
+template <size_t N>
+void small_buffer<N>::resize(size_type count, byte value)
+{
+	if (count <= m_size)
+	{
+		m_size = count;
+		return;
+	}
+	this->insert(this->end(), count - m_size, value);
+}
+
+template <size_t N>
+void small_buffer<N>::push_back(byte value)
+{
+	*this->MakeRoom(m_size, 1) = value;
+}
+
+template <size_t N>
+typename small_buffer<N>::iterator small_buffer<N>::insert(
+	const_iterator pos, size_type count, byte value)
+{
+	auto first = this->MakeRoom(static_cast<size_type>(pos - m_data), count);
+	fill_n(first, count, value);
+	return first;
+}
+
+template <size_t N>
+template <forward_iterator It>
+requires convertible_to<iter_reference_t<It>, byte>
+typename small_buffer<N>::iterator small_buffer<N>::insert(
+	const_iterator pos, It first, It last)
+{
+	auto count = static_cast<size_type>(distance(first, last));
+	auto out_first = this->MakeRoom(static_cast<size_type>(pos - m_data),
+		count);
+	if constexpr (contiguous_iterator<It> &&
+		same_as<iter_value_t<It>, byte>)
+	{
+		if (count != 0)
+		{
+			memcpy(out_first, to_address(first), count);
+		}
+	}
+	else
+	{
+		copy(first, last, out_first);
+	}
+	return out_first;
+}
+
+template <size_t N>
+bool small_buffer<N>::operator==(const small_buffer& other) const noexcept
+{
+	return ranges::equal(*this, other);
+}
+
+template <size_t N>
+byte* small_buffer<N>::MakeRoom(size_type offset, size_type count)
+{
+	if (count > this->max_size() - m_size)
+	{
+		throw length_error{"small_buffer::insert"};
+	}
+	auto new_size = m_size + count;
+	if (new_size > m_capacity)
+	{
+		this->reserve(min(max(new_size, m_capacity * 2), this->max_size()));
+	}
+	if (offset != m_size)
+	{
+		memmove(m_data + offset + count, m_data + offset, m_size - offset);
+	}
+	m_size = new_size;
+	return m_data + offset;
+}
+
+template <size_t N>
+void small_buffer<N>::Deallocate() noexcept
+{
+	if (!this->is_inline())
+	{
+		delete[] m_data;
+	}
+}
+
+}
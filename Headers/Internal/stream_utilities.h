@@ -6,9 +6,30 @@
 
 #pragma once
 
+#include <vector>
+
+#include "growth_policy.h"
+#include "stream_concepts.h"
+
 namespace std::io::Utilities
 {
 
+/// \brief A concept specifying seekable input stream whose buffer holds the
+/// whole stream contiguously so that unread bytes can be accessed directly.
+template <typename S>
+concept contiguous_input_stream = input_stream<S> && seekable_stream<S> &&
+	requires(S& s)
+	{
+		span<const byte>{s.get_buffer()};
+	};
+
+/// \brief Returns the bytes of the stream buffer starting from the stream
+/// position.
+/// \param[in] s Stream to inspect.
+/// \return Unread bytes.
+template <contiguous_input_stream S>
+constexpr span<const byte> GetUnreadBytes(const S& s) noexcept;
+
 /// \brief Returns the amount of bytes that can be transferred safely in one
 /// operation.
 /// \tparam Position Type of the stream position.
@@ -20,6 +41,13 @@ template <typename Position>
 constexpr auto GetBytesToTransfer(Position stream_buffer_size,
 	Position stream_position, ptrdiff_t transfer_buffer_size) noexcept;
 
+/// \brief Copies bytes between buffers that don't overlap. Up to 64 bytes are
+/// copied by a pair of overlapping fixed-size moves instead of calling memcpy.
+/// \param[in] first Pointer to the first byte to copy.
+/// \param[in] count Amount of bytes to copy.
+/// \param[out] out Pointer to the buffer to copy to.
+constexpr void CopyBytes(const byte* first, size_t count, byte* out) noexcept;
+
 /// \brief Reads zero or more bytes from the stream to the given buffer and
 /// advances stream position by the amount of bytes read.
 /// \tparam Buffer Type of the stream buffer.
@@ -60,6 +88,7 @@ constexpr streamsize WriteSomeFixed(Buffer& out_buffer, Position& pos,
 /// \param[in,out] out_buffer Stream buffer to write to.
 /// \param[in,out] pos Stream position to start writing to.
 /// \param[in] in_buffer Buffer to read from.
+/// \param[in] growth Growth policy used when the stream buffer is expanded.
 /// \return Amount of bytes written.
 /// \throw std::io::io_error If stream position at the start of writing is
 /// already at the end of the stream buffer of maximum size or has maximum value
@@ -67,9 +96,62 @@ constexpr streamsize WriteSomeFixed(Buffer& out_buffer, Position& pos,
 /// \throw std::bad_alloc If stream position at the start of writing is at the
 /// end of the stream buffer and there was not enough memory to allocate the
 /// stream buffer of required size.
+/// \note Bytes are appended to the stream buffer without initializing them
+/// first. Bytes between the end of the stream buffer and the stream position
+/// are zeroed.
 template <typename Buffer, typename Position>
 constexpr streamsize WriteSomeDynamic(Buffer& out_buffer, Position& pos,
-	span<const byte> in_buffer);
+	span<const byte> in_buffer, const growth_policy auto& growth);
+
+/// \brief Makes the given amount of bytes at the stream position available
+/// for writing in place and advances stream position past them.
+/// \tparam Buffer Type of the stream buffer. Must be contiguous.
+/// \tparam Position Type of the stream position.
+/// \param[in,out] out_buffer Stream buffer to write to.
+/// \param[in,out] pos Stream position to start writing to.
+/// \param[in] count Amount of bytes.
+/// \param[in] growth Growth policy used when the stream buffer is expanded.
+/// \return Bytes to write to. Bytes past the previous end of the stream buffer
+/// are value-initialized by the allocator of the stream buffer.
+/// \throw std::io::io_error If the stream buffer of maximum size can't hold the
+/// bytes.
+/// \throw std::bad_alloc If there was not enough memory.
+template <typename Buffer, typename Position>
+constexpr span<byte> WriteUninitialized(Buffer& out_buffer, Position& pos,
+	size_t count, const growth_policy auto& growth);
+
+/// \brief Returns the given amount of elements from the stream buffer without
+/// copying and advances stream position past them.
+/// \tparam Buffer Type of the stream buffer. Must be contiguous.
+/// \tparam Position Type of the stream position.
+/// \param[in] in_buffer Stream buffer to read from.
+/// \param[in,out] pos Stream position to start reading from.
+/// \param[in] count Amount of elements to read.
+/// \param[in] element_size Size of one element in bytes.
+/// \return Bytes of the elements.
+/// \throw std::io::io_error If the stream buffer has fewer elements left. Stream
+/// position is not changed in that case.
+template <typename Buffer, typename Position>
+constexpr span<const byte> ReadViewBytes(const Buffer& in_buffer,
+	Position& pos, size_t count, size_t element_size);
+
+/// \brief Returns the given amount of objects from the stream buffer and
+/// advances stream position past them. If the objects are not suitably aligned
+/// in the stream buffer, they are copied to the given storage.
+/// \tparam T Type of the objects. Must be trivially copyable.
+/// \tparam Buffer Type of the stream buffer. Must be contiguous.
+/// \tparam Position Type of the stream position.
+/// \param[in] in_buffer Stream buffer to read from.
+/// \param[in,out] pos Stream position to start reading from.
+/// \param[in] count Amount of objects to read.
+/// \param[out] storage Storage for misaligned objects.
+/// \return Objects in the stream buffer or in the storage.
+/// \throw std::io::io_error If the stream buffer has fewer objects left or
+/// they are misaligned and don't fit into the storage. Stream position is not
+/// changed in that case.
+template <typename T, typename Buffer, typename Position>
+span<const T> ReadView(const Buffer& in_buffer, Position& pos, size_t count,
+	span<T> storage);
 
 }
 
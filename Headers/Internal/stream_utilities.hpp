@@ -7,12 +7,24 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 #include "io_error.h"
 
 namespace std::io::Utilities
 {
 
+template <contiguous_input_stream S>
+constexpr span<const byte> GetUnreadBytes(const S& s) noexcept
+{
+	span<const byte> buffer{s.get_buffer()};
+	auto pos = static_cast<size_t>(s.get_position().value());
+	return buffer.subspan(min(pos, buffer.size()));
+}
+
 template <typename Position>
 constexpr auto GetBytesToTransfer(Position stream_buffer_size,
 	Position stream_position, ptrdiff_t transfer_buffer_size) noexcept
@@ -41,16 +53,84 @@ constexpr auto GetBytesToTransfer(Position stream_buffer_size,
 	return temp_result;
 }
 
+/// \brief Copies N to 2N bytes via two fixed-size moves that overlap in the
+/// middle.
+/// \tparam N Size of each move.
+/// \param[in] first Pointer to the first byte to copy.
+/// \param[in] count Amount of bytes to copy.
+/// \param[out] out Pointer to the buffer to copy to.
+template <size_t N>
+inline void CopyOverlappingBytes(const byte* first, size_t count, byte* out)
+	noexcept
+{
+	array<byte, N> head;
+	array<byte, N> tail;
+	memcpy(head.data(), first, N);
+	memcpy(tail.data(), first + count - N, N);
+	memcpy(out, head.data(), N);
+	memcpy(out + count - N, tail.data(), N);
+}
+
+constexpr void CopyBytes(const byte* first, size_t count, byte* out) noexcept
+{
+	if (is_constant_evaluated())
+	{
+		copy_n(first, count, out);
+		return;
+	}
+	if (count > 64)
+	{
+		memcpy(out, first, count);
+	}
+	else if (count > 32)
+	{
+		CopyOverlappingBytes<32>(first, count, out);
+	}
+	else if (count > 16)
+	{
+		CopyOverlappingBytes<16>(first, count, out);
+	}
+	else if (count > 8)
+	{
+		CopyOverlappingBytes<8>(first, count, out);
+	}
+	else if (count > 4)
+	{
+		CopyOverlappingBytes<4>(first, count, out);
+	}
+	else if (count > 2)
+	{
+		CopyOverlappingBytes<2>(first, count, out);
+	}
+	else if (count > 0)
+	{
+		CopyOverlappingBytes<1>(first, count, out);
+	}
+}
+
 template <typename Buffer, typename Position>
 constexpr streamsize ReadSome(const Buffer& in_buffer, Position& pos,
 	span<byte> out_buffer)
 {
 	auto out_size = ranges::ssize(out_buffer);
+	auto in_size = ranges::ssize(in_buffer);
+	if constexpr (ranges::contiguous_range<const Buffer> &&
+		same_as<ranges::range_value_t<Buffer>, byte>)
+	{
+		if ((pos < in_size) && (out_size <= in_size - pos))
+		{
+			// Whole buffer fits before the end of stream so the position can't
+			// overflow and no other checks are needed.
+			CopyBytes(ranges::data(in_buffer) + pos,
+				static_cast<size_t>(out_size), ranges::data(out_buffer));
+			pos += static_cast<Position>(out_size);
+			return out_size;
+		}
+	}
 	if (out_size == 0)
 	{
 		return 0;
 	}
-	auto in_size = ranges::ssize(in_buffer);
 	if (pos >= in_size)
 	{
 		// Already at the end of stream.
@@ -75,11 +155,24 @@ constexpr streamsize WriteSomeFixed(Buffer& out_buffer, Position& pos,
 	span<const byte> in_buffer)
 {
 	auto in_size = ranges::ssize(in_buffer);
+	auto out_size = ranges::ssize(out_buffer);
+	if constexpr (ranges::contiguous_range<Buffer> &&
+		same_as<ranges::range_value_t<Buffer>, byte>)
+	{
+		if ((pos < out_size) && (in_size <= out_size - pos))
+		{
+			// Whole buffer fits before the end of stream so the position can't
+			// overflow and no other checks are needed.
+			CopyBytes(ranges::data(in_buffer), static_cast<size_t>(in_size),
+				ranges::data(out_buffer) + pos);
+			pos += static_cast<Position>(in_size);
+			return in_size;
+		}
+	}
 	if (in_size == 0)
 	{
 		return 0;
 	}
-	auto out_size = ranges::ssize(out_buffer);
 	if (pos >= out_size)
 	{
 		// Already at the end of stream.
@@ -102,7 +195,7 @@ constexpr streamsize WriteSomeFixed(Buffer& out_buffer, Position& pos,
 
 template <typename Buffer, typename Position>
 constexpr streamsize WriteSomeDynamic(Buffer& out_buffer, Position& pos,
-	span<const byte> in_buffer)
+	span<const byte> in_buffer, const growth_policy auto& growth)
 {
 	auto in_size = ranges::ssize(in_buffer);
 	if (in_size == 0)
@@ -135,13 +228,85 @@ constexpr streamsize WriteSomeDynamic(Buffer& out_buffer, Position& pos,
 	}
 	auto bytes_to_write = GetBytesToTransfer(max_out_size, pos, in_size);
 	auto end_position = pos + bytes_to_write;
-	out_buffer.resize(end_position);
+	ReserveBuffer(out_buffer, static_cast<size_t>(end_position), growth);
+	if (pos > out_size)
+	{
+		out_buffer.insert(ranges::end(out_buffer),
+			static_cast<size_t>(pos - out_size), byte{0});
+	}
+	// Inserting copies the bytes straight into the spare capacity instead of
+	// zeroing them first.
 	auto in_first = ranges::begin(in_buffer);
 	auto in_last = in_first + bytes_to_write;
-	auto out_first = ranges::begin(out_buffer) + pos;
-	ranges::copy(in_first, in_last, out_first);
+	out_buffer.insert(ranges::end(out_buffer), in_first, in_last);
 	pos = end_position;
 	return bytes_to_write;
 }
 
+template <typename Buffer, typename Position>
+constexpr span<byte> WriteUninitialized(Buffer& out_buffer, Position& pos,
+	size_t count, const growth_policy auto& growth)
+{
+	auto max_out_size = static_cast<typename Buffer::difference_type>(
+		out_buffer.max_size());
+	auto limit = min<streamoff>(max_out_size, position::max().value());
+	auto available = (pos >= limit) ? streamoff{0} : limit - pos;
+	if (count > static_cast<size_t>(available))
+	{
+		throw io_error{"WriteUninitialized", io_errc::file_too_large};
+	}
+	auto out_size = ranges::ssize(out_buffer);
+	auto end_position = pos + static_cast<Position>(count);
+	if (end_position > out_size)
+	{
+		ReserveBuffer(out_buffer, static_cast<size_t>(end_position), growth);
+		if (pos > out_size)
+		{
+			out_buffer.insert(ranges::end(out_buffer),
+				static_cast<size_t>(pos - out_size), byte{0});
+		}
+		out_buffer.resize(static_cast<size_t>(end_position));
+	}
+	span<byte> result{ranges::data(out_buffer) + pos, count};
+	pos = end_position;
+	return result;
+}
+
+template <typename Buffer, typename Position>
+constexpr span<const byte> ReadViewBytes(const Buffer& in_buffer,
+	Position& pos, size_t count, size_t element_size)
+{
+	span<const byte> bytes{ranges::data(in_buffer), ranges::size(in_buffer)};
+	auto first = min(static_cast<size_t>(pos), bytes.size());
+	bytes = bytes.subspan(first);
+	if (count > bytes.size() / element_size)
+	{
+		throw io_error{"read_view: Reached end of stream",
+			io_errc::reached_end_of_file};
+	}
+	bytes = bytes.first(count * element_size);
+	pos += static_cast<Position>(bytes.size());
+	return bytes;
+}
+
+template <typename T, typename Buffer, typename Position>
+span<const T> ReadView(const Buffer& in_buffer, Position& pos, size_t count,
+	span<T> storage)
+{
+	auto old_position = pos;
+	auto bytes = ReadViewBytes(in_buffer, pos, count, sizeof(T));
+	if (reinterpret_cast<uintptr_t>(bytes.data()) % alignof(T) == 0)
+	{
+		return {reinterpret_cast<const T*>(bytes.data()), count};
+	}
+	if (storage.size() < count)
+	{
+		pos = old_position;
+		throw io_error{"read_view: Misaligned data doesn't fit into storage",
+			io_errc::invalid_argument};
+	}
+	memcpy(storage.data(), bytes.data(), bytes.size());
+	return storage.first(count);
+}
+
 }
@@ -0,0 +1,78 @@
+/// \file
+/// \brief Internal header file that describes the try_read function
+/// template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include "read.h"
+
+namespace std::io
+{
+
+/// \brief Outcome of the resumable read.
+enum class read_status
+{
+	complete,
+	need_more_bytes
+};
+
+/// \brief Reads the object if the stream has all of its bytes.
+/// \details If the stream ends before the whole object is read, stream
+/// position and limits of the context are restored and the object is left
+/// unchanged, so reading can be retried once more bytes arrive. Objects of
+/// fixed size in the native representation are checked against the size of
+/// the stream before reading, other objects are read to a temporary object
+/// first. The stream is also checked against the minimum size of the object
+/// and, for length-prefixed containers, against the size implied by the
+/// length prefix, so incomplete objects are usually detected without
+/// throwing.
+/// \tparam T Type of the object.
+/// \tparam C Type of the context. Stream must be seekable.
+/// \param[out] object Object to read to.
+/// \param[in,out] ctx Context to read from.
+/// \return read_status::complete if the object was read,
+/// read_status::need_more_bytes otherwise.
+/// \throw std::io::io_error If reading has failed for any reason other than
+/// reaching the end of the stream.
+template <typename T, input_context C>
+requires seekable_stream<typename C::stream_type> && readable_from<T, C> &&
+	default_initializable<T> && movable<T>
+read_status try_read(T& object, C& ctx);
+
+namespace Utilities
+{
+
+/// \brief Returns the amount of bytes between the stream position and the end
+/// of the stream.
+/// \param[in,out] s Stream to check. Position is restored afterwards.
+/// \return Amount of bytes left.
+template <seekable_stream S>
+constexpr streamoff GetRemainingSize(S& s);
+
+/// \brief Returns the lower bound of the amount of bytes the object of the
+/// given type occupies in the stream.
+/// \tparam T Type of the object.
+/// \param[in] ctx Context to check.
+/// \return Minimum size of the object in bytes. 0 if it is not known.
+template <typename T, input_context C>
+constexpr streamoff GetMinimumSize(const C& ctx) noexcept;
+
+/// \brief Checks if the stream certainly doesn't have all bytes of the
+/// object. Length-prefixed containers are checked by peeking their length.
+/// \tparam T Type of the object.
+/// \param[in,out] ctx Context to check. Stream position is restored
+/// afterwards.
+/// \param[in] remaining_size Amount of bytes left in the stream.
+/// \return True if reading the object would reach the end of the stream.
+/// \throw std::io::io_error If peeking the length prefix has failed for any
+/// reason other than reaching the end of the stream.
+template <typename T, input_context C>
+bool IsTruncated(C& ctx, streamoff remaining_size);
+
+}
+
+}
+
+#include "try_read.hpp"
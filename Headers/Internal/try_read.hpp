@@ -0,0 +1,356 @@
+/// \file
+/// \brief Internal header file that contains implementation of the try_read
+/// function template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <algorithm>
+#include <optional>
+
+#include "io_error.h"
+
+namespace std::io
+{
+
+template <typename T, input_context C>
+requires seekable_stream<typename C::stream_type> && readable_from<T, C> &&
+	default_initializable<T> && movable<T>
+read_status try_read(T& object, C& ctx)
+{
+	auto& s = ctx.get_stream();
+	if constexpr (Utilities::bitwise_serializable<T> &&
+		(Utilities::GetAlignment<T, C>() == 1))
+	{
+		if (Utilities::IsNativeRepresentation<T>(ctx))
+		{
+			if (Utilities::GetRemainingSize(s) <
+				static_cast<streamoff>(sizeof(T)))
+			{
+				return read_status::need_more_bytes;
+			}
+			io::read(object, ctx);
+			return read_status::complete;
+		}
+	}
+	if (Utilities::IsTruncated<T>(ctx, Utilities::GetRemainingSize(s)))
+	{
+		return read_status::need_more_bytes;
+	}
+	auto start = s.get_position();
+	optional<read_limits> limits;
+	if constexpr (limited_context<C>)
+	{
+		limits = ctx.get_limits();
+	}
+	T result;
+	try
+	{
+		io::read(result, ctx);
+	}
+	catch (io_error& e)
+	{
+		if (e.code() != io_errc::reached_end_of_file)
+		{
+			throw;
+		}
+		s.seek_position(start);
+		if constexpr (limited_context<C>)
+		{
+			ctx.get_limits() = *limits;
+		}
+		return read_status::need_more_bytes;
+	}
+	object = move(result);
+	return read_status::complete;
+}
+
+namespace Utilities
+{
+
+/// \brief Returns the minimum size of the length prefix.
+/// \param[in] ctx Context to check.
+/// \return Minimum size in bytes.
+template <input_context C>
+constexpr streamoff GetMinimumLengthSize(const C& ctx) noexcept
+{
+	auto get_size = [&]<typename T>(type_identity<T>)
+	{
+		return (GetIntegerFormat<T>(ctx) == integer_format::fixed) ?
+			static_cast<streamoff>(sizeof(T)) : streamoff{1};
+	};
+	switch (GetLengthPrefixWidth(ctx))
+	{
+		case length_prefix_width::one_byte:
+		{
+			return get_size(type_identity<uint8_t>{});
+		}
+		case length_prefix_width::two_bytes:
+		{
+			return get_size(type_identity<uint16_t>{});
+		}
+		case length_prefix_width::four_bytes:
+		{
+			return get_size(type_identity<uint32_t>{});
+		}
+		default:
+		{
+			return get_size(type_identity<uint64_t>{});
+		}
+	}
+}
+
+/// \brief Returns the minimum size of the object nested in another object.
+/// Nested byte containers are prefixed with their length.
+/// \tparam T Type of the object.
+/// \param[in] ctx Context to check.
+/// \return Minimum size in bytes.
+template <typename T, input_context C>
+constexpr streamoff GetMinimumElementSize(const C& ctx) noexcept
+{
+	if constexpr (byte_container<T>)
+	{
+		return GetMinimumLengthSize(ctx);
+	}
+	else
+	{
+		return GetMinimumSize<T>(ctx);
+	}
+}
+
+/// \brief Returns the minimum size of the element of the array, vector or
+/// span. Blocks of delta bit-packed integers may take less than a byte per
+/// value so their size is not known.
+/// \tparam T Type of the element.
+/// \param[in] ctx Context to check.
+/// \return Minimum size in bytes.
+template <typename T, input_context C>
+constexpr streamoff GetMinimumArrayElementSize(const C& ctx) noexcept
+{
+	if constexpr (integral<T> && (sizeof(T) == sizeof(uint64_t)))
+	{
+		if (GetIntegerFormat<T>(ctx) == integer_format::delta_bit_packed)
+		{
+			return 0;
+		}
+	}
+	return GetMinimumElementSize<T>(ctx);
+}
+
+template <typename T, input_context C>
+constexpr streamoff GetMinimumSize(type_identity<T>, const C& ctx) noexcept
+{
+	if constexpr (CustomlyReadableFrom<T, C>)
+	{
+		return 0;
+	}
+	else if constexpr (same_as<T, bool> || same_as<T, byte>)
+	{
+		return 1;
+	}
+	else if constexpr (integral<T>)
+	{
+		return (GetIntegerFormat<T>(ctx) == integer_format::fixed) ?
+			static_cast<streamoff>(sizeof(T)) : streamoff{1};
+	}
+	else if constexpr (floating_point<T>)
+	{
+		return static_cast<streamoff>(GetFloatingPointSize<T>(
+			ctx.get_format()));
+	}
+	else if constexpr (reflectable_aggregate<T>)
+	{
+		using Fields = decltype(TieFields(declval<T&>()));
+		return [&]<size_t... I>(index_sequence<I...>)
+		{
+			return (streamoff{0} + ... + GetMinimumElementSize<remove_cvref_t<
+				tuple_element_t<I, Fields>>>(ctx));
+		}(make_index_sequence<tuple_size_v<Fields>>{});
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+template <typename CharT, typename Traits, typename Allocator,
+	input_context C>
+constexpr streamoff GetMinimumSize(
+	type_identity<basic_string<CharT, Traits, Allocator>>, const C& ctx)
+	noexcept
+{
+	if constexpr (GetStringEncoding<CharT, C>() ==
+		string_encoding::null_terminated)
+	{
+		return GetMinimumSize<CharT>(ctx);
+	}
+	else
+	{
+		return GetMinimumLengthSize(ctx);
+	}
+}
+
+template <typename T, typename Allocator, input_context C>
+requires (!same_as<T, byte>)
+constexpr streamoff GetMinimumSize(type_identity<vector<T, Allocator>>,
+	const C& ctx) noexcept
+{
+	return GetMinimumLengthSize(ctx);
+}
+
+template <typename T, size_t N, input_context C>
+constexpr streamoff GetMinimumSize(type_identity<array<T, N>>, const C& ctx)
+	noexcept
+{
+	if constexpr (same_as<T, byte>)
+	{
+		return static_cast<streamoff>(N);
+	}
+	else
+	{
+		return static_cast<streamoff>(N) *
+			GetMinimumArrayElementSize<T>(ctx);
+	}
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+	input_context C>
+constexpr streamoff GetMinimumSize(
+	type_identity<map<Key, T, Compare, Allocator>>, const C& ctx) noexcept
+{
+	return GetMinimumLengthSize(ctx);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+	typename Allocator, input_context C>
+constexpr streamoff GetMinimumSize(
+	type_identity<unordered_map<Key, T, Hash, KeyEqual, Allocator>>,
+	const C& ctx) noexcept
+{
+	return GetMinimumLengthSize(ctx);
+}
+
+template <typename T, input_context C>
+constexpr streamoff GetMinimumSize(type_identity<optional<T>>, const C& ctx)
+	noexcept
+{
+	return GetMinimumSize<bool>(ctx);
+}
+
+template <typename... Types, input_context C>
+constexpr streamoff GetMinimumSize(type_identity<variant<Types...>>,
+	const C& ctx) noexcept
+{
+	return GetMinimumLengthSize(ctx);
+}
+
+template <typename T, input_context C>
+constexpr streamoff GetMinimumSize(const C& ctx) noexcept
+{
+	return GetMinimumSize(type_identity<T>{}, ctx);
+}
+
+/// \brief Returns the minimum size of one element of the length-prefixed
+/// container.
+/// \tparam T Type of the container.
+/// \param[in] ctx Context to check.
+/// \return Minimum size of the element in bytes. 0 if T is not a
+/// length-prefixed container or the size is not known.
+template <typename T, input_context C>
+constexpr streamoff GetMinimumElementSize(type_identity<T>, const C&) noexcept
+{
+	return 0;
+}
+
+template <typename CharT, typename Traits, typename Allocator,
+	input_context C>
+constexpr streamoff GetMinimumElementSize(
+	type_identity<basic_string<CharT, Traits, Allocator>>, const C& ctx)
+	noexcept
+{
+	if constexpr (GetStringEncoding<CharT, C>() ==
+		string_encoding::null_terminated)
+	{
+		return 0;
+	}
+	else
+	{
+		return GetMinimumSize<CharT>(ctx);
+	}
+}
+
+template <typename T, typename Allocator, input_context C>
+requires (!same_as<T, byte>)
+constexpr streamoff GetMinimumElementSize(type_identity<vector<T, Allocator>>,
+	const C& ctx) noexcept
+{
+	return GetMinimumArrayElementSize<T>(ctx);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator,
+	input_context C>
+constexpr streamoff GetMinimumElementSize(
+	type_identity<map<Key, T, Compare, Allocator>>, const C& ctx) noexcept
+{
+	return GetMinimumElementSize<Key>(ctx) + GetMinimumElementSize<T>(ctx);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+	typename Allocator, input_context C>
+constexpr streamoff GetMinimumElementSize(
+	type_identity<unordered_map<Key, T, Hash, KeyEqual, Allocator>>,
+	const C& ctx) noexcept
+{
+	return GetMinimumElementSize<Key>(ctx) + GetMinimumElementSize<T>(ctx);
+}
+
+template <typename T, input_context C>
+bool IsTruncated(C& ctx, streamoff remaining_size)
+{
+	if (remaining_size < GetMinimumSize<T>(ctx))
+	{
+		return true;
+	}
+	auto element_size = GetMinimumElementSize(type_identity<T>{}, ctx);
+	if (element_size == 0)
+	{
+		return false;
+	}
+	// Peek the length and compare it with the bytes that are left. Only a
+	// length prefix that is itself incomplete makes reading it throw.
+	auto& s = ctx.get_stream();
+	auto start = s.get_position();
+	size_t length;
+	try
+	{
+		length = ReadLength(ctx);
+	}
+	catch (io_error& e)
+	{
+		if (e.code() != io_errc::reached_end_of_file)
+		{
+			throw;
+		}
+		s.seek_position(start);
+		return true;
+	}
+	auto prefix_size = s.get_position().value() - start.value();
+	s.seek_position(start);
+	return static_cast<size_t>((remaining_size - prefix_size) / element_size) <
+		length;
+}
+
+template <seekable_stream S>
+constexpr streamoff GetRemainingSize(S& s)
+{
+	auto pos = s.get_position();
+	s.seek_position(base_position::end);
+	auto end = s.get_position();
+	s.seek_position(pos);
+	return max(end.value() - pos.value(), streamoff{0});
+}
+
+}
+
+}
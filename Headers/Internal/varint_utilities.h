@@ -0,0 +1,135 @@
+/// \file
+/// \brief Internal header file that describes the utility functions for
+/// variable-length integer encodings.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace std::io::Utilities
+{
+
+/// \brief Type of the integral value used to encode the given integral or
+/// enumeration type. Signed types are encoded via their unsigned counterpart.
+template <typename T>
+using VarintType = make_unsigned_t<typename conditional_t<is_enum_v<T>,
+	underlying_type<T>, type_identity<T>>::type>;
+
+/// \brief Maximum amount of bytes in the LEB128 encoding of the given type.
+template <typename T>
+inline constexpr size_t MaxLEB128Size = (sizeof(T) * CHAR_BIT + 6) / 7;
+
+/// \brief Maximum amount of bytes in the encoding of one group of group varint
+/// values, not including the tag byte.
+inline constexpr size_t MaxGroupVarintSize = 4 * sizeof(uint32_t);
+
+/// \brief Maps signed integer to unsigned so that values of small magnitude
+/// produce small results.
+/// \param[in] value Value to map.
+/// \return Mapped value.
+constexpr auto ZigZagEncode(signed_integral auto value) noexcept;
+
+/// \brief Reverses the transformation made by ZigZagEncode.
+/// \tparam T Signed type of the result.
+/// \param[in] value Value to map.
+/// \return Mapped value.
+template <signed_integral T>
+constexpr T ZigZagDecode(make_unsigned_t<T> value) noexcept;
+
+/// \brief Converts given integral or enumeration object to the unsigned value
+/// that is going to be encoded.
+/// \param[in] object Object to convert.
+/// \return Unsigned value to encode.
+template <typename T>
+requires integral<T> || is_enum_v<T>
+constexpr VarintType<T> ToVarint(T object) noexcept;
+
+/// \brief Converts decoded unsigned value to the integral object.
+/// \tparam T Type of the integral object.
+/// \param[in] value Decoded value.
+/// \return Integral object.
+template <integral T>
+constexpr T FromVarint(VarintType<T> value) noexcept;
+
+/// \brief Encodes the given value as unsigned LEB128.
+/// \param[in] value Value to encode.
+/// \param[out] out_buffer Buffer to write to. Must be at least
+/// MaxLEB128Size bytes.
+/// \return Amount of bytes written.
+constexpr size_t EncodeLEB128(unsigned_integral auto value,
+	span<byte> out_buffer) noexcept;
+
+/// \brief Decodes unsigned LEB128 value from the start of the given bytes.
+/// \tparam U Unsigned type of the value.
+/// \param[in] in_buffer Bytes to decode.
+/// \param[out] value Decoded value.
+/// \return Amount of bytes the value occupies or 0 if bytes end before the
+/// end of the value.
+/// \throw std::io::io_error If encoded value doesn't fit into U.
+template <unsigned_integral U>
+constexpr size_t DecodeLEB128(span<const byte> in_buffer, U& value);
+
+/// \brief Reads unsigned LEB128 value from the stream. Contiguous streams are
+/// decoded from their buffer directly, other streams are read byte by byte so
+/// that no bytes past the end of the value are consumed.
+/// \tparam U Unsigned type of the value.
+/// \param[in,out] s Stream to read from.
+/// \return Decoded value.
+/// \throw std::io::io_error If encoded value doesn't fit into U or if the
+/// stream has ended before the value.
+template <unsigned_integral U>
+constexpr U ReadLEB128(input_stream auto& s);
+
+/// \brief Reads LEB128 values from the stream and converts them to the
+/// integral objects. Contiguous streams are decoded from their buffer in one
+/// pass and their position is moved once.
+/// \param[in,out] s Stream to read from.
+/// \param[out] values Objects to read.
+/// \throw std::io::io_error If encoded value doesn't fit into its type or if
+/// the stream has ended before the values.
+template <integral T>
+constexpr void ReadLEB128Values(input_stream auto& s, span<T> values);
+
+/// \brief Encodes up to 4 values as one group varint group.
+/// \param[in] values Values to encode.
+/// \param[out] out_buffer Buffer to write to. Must be at least
+/// MaxGroupVarintSize + 1 bytes.
+/// \return Amount of bytes written, including the tag byte.
+constexpr size_t EncodeGroupVarint(span<const uint32_t> values,
+	span<byte> out_buffer) noexcept;
+
+/// \brief Returns the amount of data bytes of the group varint group.
+/// \param[in] tag Tag byte of the group.
+/// \param[in] count Amount of values in the group.
+/// \return Amount of data bytes following the tag byte.
+constexpr size_t GetGroupVarintSize(byte tag, size_t count) noexcept;
+
+/// \brief Decodes up to 4 values of one group varint group. When compiled with
+/// AVX2 support, full groups are decoded with a single byte shuffle.
+/// \param[in] tag Tag byte of the group.
+/// \param[in] in_buffer Data bytes of the group. Must be at least
+/// MaxGroupVarintSize + 3 bytes so that every value can be loaded as a whole
+/// word without branching on its length.
+/// \param[out] values Buffer to decode to.
+constexpr void DecodeGroupVarint(byte tag, span<const byte> in_buffer,
+	span<uint32_t> values) noexcept;
+
+/// \brief Reads group varint values from the stream and converts them to the
+/// integral objects. Contiguous streams are decoded from their buffer in one
+/// pass and their position is moved once.
+/// \param[in,out] s Stream to read from.
+/// \param[out] values Objects to read.
+/// \throw std::io::io_error If the stream has ended before the values.
+template <integral T>
+requires (sizeof(T) == sizeof(uint32_t))
+constexpr void ReadGroupVarintValues(input_stream auto& s, span<T> values);
+
+}
+
+#include "varint_utilities.hpp"
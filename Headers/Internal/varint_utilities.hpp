@@ -0,0 +1,337 @@
+/// \file
+/// \brief Internal header file that contains implementation of the utility
+/// functions for variable-length integer encodings.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "read_raw.h"
+#include "stream_utilities.h"
+
+namespace std::io::Utilities
+{
+
+constexpr auto ZigZagEncode(signed_integral auto value) noexcept
+{
+	using U = make_unsigned_t<decltype(value)>;
+	constexpr auto bits = sizeof(value) * CHAR_BIT;
+	// Arithmetic shift of the sign bit produces all zeroes or all ones.
+	return static_cast<U>((static_cast<U>(value) << 1) ^
+		static_cast<U>(value >> (bits - 1)));
+}
+
+template <signed_integral T>
+constexpr T ZigZagDecode(make_unsigned_t<T> value) noexcept
+{
+	using U = make_unsigned_t<T>;
+	return static_cast<T>(static_cast<U>(value >> 1) ^
+		static_cast<U>(-static_cast<U>(value & 1)));
+}
+
+template <typename T>
+requires integral<T> || is_enum_v<T>
+constexpr VarintType<T> ToVarint(T object) noexcept
+{
+	if constexpr (is_enum_v<T>)
+	{
+		return ToVarint(static_cast<underlying_type_t<T>>(object));
+	}
+	else if constexpr (signed_integral<T>)
+	{
+		return ZigZagEncode(object);
+	}
+	else
+	{
+		return static_cast<VarintType<T>>(object);
+	}
+}
+
+template <integral T>
+constexpr T FromVarint(VarintType<T> value) noexcept
+{
+	if constexpr (signed_integral<T>)
+	{
+		return ZigZagDecode<T>(value);
+	}
+	else
+	{
+		return static_cast<T>(value);
+	}
+}
+
+constexpr size_t EncodeLEB128(unsigned_integral auto value,
+	span<byte> out_buffer) noexcept
+{
+	size_t size = 0;
+	while (value >= 0x80)
+	{
+		out_buffer[size] = byte{static_cast<unsigned char>(value | 0x80)};
+		value >>= 7;
+		++size;
+	}
+	out_buffer[size] = byte{static_cast<unsigned char>(value)};
+	return size + 1;
+}
+
+template <unsigned_integral U>
+constexpr size_t DecodeLEB128(span<const byte> in_buffer, U& value)
+{
+	constexpr auto bits = sizeof(U) * CHAR_BIT;
+	U result = 0;
+	size_t size = 0;
+	for (size_t shift = 0; shift < bits; shift += 7)
+	{
+		if (size == in_buffer.size())
+		{
+			return 0;
+		}
+		auto byte_value = to_integer<unsigned char>(in_buffer[size]);
+		++size;
+		auto payload = static_cast<U>(byte_value & 0x7F);
+		// Last byte may only contain as many bits as there are left in U.
+		if ((bits - shift < 7) && ((payload >> (bits - shift)) != 0))
+		{
+			throw io_error{"DecodeLEB128", io_errc::value_too_large};
+		}
+		result |= static_cast<U>(payload << shift);
+		if ((byte_value & 0x80) == 0)
+		{
+			value = result;
+			return size;
+		}
+	}
+	throw io_error{"DecodeLEB128", io_errc::value_too_large};
+}
+
+template <unsigned_integral U>
+constexpr U ReadLEB128(input_stream auto& s)
+{
+	if constexpr (contiguous_input_stream<remove_reference_t<decltype(s)>>)
+	{
+		U result;
+		auto size = DecodeLEB128(GetUnreadBytes(s), result);
+		if (size == 0)
+		{
+			throw io_error{"ReadLEB128: Reached end of stream",
+				io_errc::reached_end_of_file};
+		}
+		s.seek_position(offset{static_cast<streamoff>(size)});
+		return result;
+	}
+	else
+	{
+		// Decode as bytes arrive so that the stream is never overread.
+		array<byte, MaxLEB128Size<U>> buffer;
+		for (size_t size = 0; size < buffer.size(); ++size)
+		{
+			read_raw(buffer[size], s);
+			if ((to_integer<unsigned char>(buffer[size]) & 0x80) == 0)
+			{
+				U result;
+				DecodeLEB128(span<const byte>{buffer}.first(size + 1), result);
+				return result;
+			}
+		}
+		throw io_error{"ReadLEB128", io_errc::value_too_large};
+	}
+}
+
+template <integral T>
+constexpr void ReadLEB128Values(input_stream auto& s, span<T> values)
+{
+	using U = VarintType<T>;
+	if constexpr (contiguous_input_stream<remove_reference_t<decltype(s)>>)
+	{
+		auto bytes = GetUnreadBytes(s);
+		size_t size = 0;
+		for (auto& element : values)
+		{
+			U value;
+			auto value_size = DecodeLEB128(bytes.subspan(size), value);
+			if (value_size == 0)
+			{
+				s.seek_position(offset{static_cast<streamoff>(size)});
+				throw io_error{"ReadLEB128Values: Reached end of stream",
+					io_errc::reached_end_of_file};
+			}
+			element = FromVarint<T>(value);
+			size += value_size;
+		}
+		s.seek_position(offset{static_cast<streamoff>(size)});
+	}
+	else
+	{
+		for (auto& element : values)
+		{
+			element = FromVarint<T>(ReadLEB128<U>(s));
+		}
+	}
+}
+
+constexpr size_t EncodeGroupVarint(span<const uint32_t> values,
+	span<byte> out_buffer) noexcept
+{
+	unsigned int tag = 0;
+	size_t size = 1;
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		auto value = values[i];
+		// Amount of bytes minus one, computed without branches.
+		unsigned int length = (value > 0xFF) + (value > 0xFFFF) +
+			(value > 0xFFFFFF);
+		tag |= length << (2 * i);
+		for (unsigned int j = 0; j <= length; ++j)
+		{
+			out_buffer[size] = byte{static_cast<unsigned char>(
+				value >> (CHAR_BIT * j))};
+			++size;
+		}
+	}
+	out_buffer[0] = byte{static_cast<unsigned char>(tag)};
+	return size;
+}
+
+constexpr size_t GetGroupVarintSize(byte tag, size_t count) noexcept
+{
+	auto raw_tag = to_integer<unsigned int>(tag);
+	size_t size = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		size += ((raw_tag >> (2 * i)) & 3) + 1;
+	}
+	return size;
+}
+
+#if defined(__AVX2__)
+/// \brief Masks for _mm_shuffle_epi8 that move the data bytes of a full group
+/// to 4 little endian words, indexed by the tag byte.
+inline constexpr auto GroupVarintShuffleMasks = []
+{
+	array<array<char, 16>, 256> result{};
+	for (unsigned int tag = 0; tag < 256; ++tag)
+	{
+		int offset = 0;
+		for (int i = 0; i < 4; ++i)
+		{
+			int length = static_cast<int>((tag >> (2 * i)) & 3) + 1;
+			for (int j = 0; j < 4; ++j)
+			{
+				result[tag][4 * i + j] = (j < length) ?
+					static_cast<char>(offset + j) : char{-1};
+			}
+			offset += length;
+		}
+	}
+	return result;
+}();
+#endif
+
+constexpr void DecodeGroupVarint(byte tag, span<const byte> in_buffer,
+	span<uint32_t> values) noexcept
+{
+	auto raw_tag = to_integer<unsigned int>(tag);
+#if defined(__AVX2__)
+	if constexpr (endian::native == endian::little)
+	{
+		if (!is_constant_evaluated() && (values.size() == 4))
+		{
+			// Whole group is in the first MaxGroupVarintSize bytes.
+			auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+				ranges::data(in_buffer)));
+			auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+				GroupVarintShuffleMasks[raw_tag].data()));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(ranges::data(values)),
+				_mm_shuffle_epi8(data, mask));
+			return;
+		}
+	}
+#endif
+	size_t offset = 0;
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		auto length = ((raw_tag >> (2 * i)) & 3) + 1;
+		// Always load the whole word and mask off the bytes of the next
+		// values. Compilers turn this into a single unaligned load.
+		auto it = ranges::begin(in_buffer) + offset;
+		uint32_t word = to_integer<uint32_t>(it[0]) |
+			(to_integer<uint32_t>(it[1]) << 8) |
+			(to_integer<uint32_t>(it[2]) << 16) |
+			(to_integer<uint32_t>(it[3]) << 24);
+		values[i] = word & (0xFFFFFFFFu >> (CHAR_BIT * (4 - length)));
+		offset += length;
+	}
+}
+
+template <integral T>
+requires (sizeof(T) == sizeof(uint32_t))
+constexpr void ReadGroupVarintValues(input_stream auto& s, span<T> values)
+{
+	using U = VarintType<T>;
+	array<uint32_t, 4> group;
+	if constexpr (contiguous_input_stream<remove_reference_t<decltype(s)>>)
+	{
+		auto bytes = GetUnreadBytes(s);
+		size_t size = 0;
+		// Full groups that have enough bytes after them are decoded in
+		// place, the rest are copied to a zeroed buffer first.
+		array<byte, MaxGroupVarintSize + 3> data;
+		while (!values.empty())
+		{
+			auto count = min(values.size(), group.size());
+			auto group_size = (size < bytes.size()) ?
+				GetGroupVarintSize(bytes[size], count) : 0;
+			if ((size == bytes.size()) ||
+				(bytes.size() - size - 1 < group_size))
+			{
+				s.seek_position(offset{static_cast<streamoff>(size)});
+				throw io_error{"ReadGroupVarintValues: Reached end of stream",
+					io_errc::reached_end_of_file};
+			}
+			auto tag = bytes[size];
+			auto group_bytes = bytes.subspan(size + 1);
+			if (group_bytes.size() < data.size())
+			{
+				ranges::fill(data, byte{0});
+				ranges::copy(group_bytes.first(group_size),
+					ranges::begin(data));
+				group_bytes = data;
+			}
+			DecodeGroupVarint(tag, group_bytes,
+				span<uint32_t>{group}.first(count));
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] = FromVarint<T>(static_cast<U>(group[i]));
+			}
+			size += group_size + 1;
+			values = values.subspan(count);
+		}
+		s.seek_position(offset{static_cast<streamoff>(size)});
+	}
+	else
+	{
+		// Read one group at a time so that the stream is never overread.
+		array<byte, MaxGroupVarintSize + 3> data{};
+		while (!values.empty())
+		{
+			auto count = min(values.size(), group.size());
+			byte tag;
+			read_raw(tag, s);
+			auto group_size = GetGroupVarintSize(tag, count);
+			auto group_bytes = span<byte>{data}.first(group_size);
+			read_raw(group_bytes, s);
+			DecodeGroupVarint(tag, data, span<uint32_t>{group}.first(count));
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] = FromVarint<T>(static_cast<U>(group[i]));
+			}
+			values = values.subspan(count);
+		}
+	}
+}
+
+}
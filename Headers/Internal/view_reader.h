@@ -0,0 +1,69 @@
+/// \file
+/// \brief Internal header file that describes the view_reader class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "stream_concepts.h"
+#include "read.h"
+
+namespace std::io
+{
+
+namespace Utilities
+{
+
+/// \brief Input stream that can return views into its buffer.
+template <typename S>
+concept viewable_stream = input_stream<S> && seekable_stream<S> &&
+	requires(S& s, size_t count)
+	{
+		{s.template read_view<byte>(count)} -> same_as<span<const byte>>;
+		span<const byte>{s.get_buffer()};
+	};
+
+}
+
+/// \brief Reads arrays of values as views into the buffer of the stream.
+/// \details When the encoding of the context matches the object
+/// representation of the values and the data is suitably aligned in memory,
+/// returned spans point directly into the buffer of the stream. Otherwise
+/// values are read to storage owned by the reader. Returned spans are valid
+/// as long as both the reader and the buffer of the stream are alive.
+/// \tparam C Type of the context to read from.
+
+template <input_context C>
+requires Utilities::viewable_stream<typename C::stream_type>
+class view_reader final
+{
+public:
+	// Constructor
+	constexpr explicit view_reader(C& ctx) noexcept;
+	
+	// Context
+	constexpr C& get_context() noexcept;
+	constexpr const C& get_context() const noexcept;
+	
+	// Reading
+	template <typename T>
+	requires (!is_const_v<T>) && readable_from<span<T>, C>
+	span<const T> read(size_t count);
+	template <typename T>
+	bool is_viewable(size_t count) const noexcept;
+private:
+	/// \brief Returns the bytes of the buffer of the stream starting from the
+	/// stream position.
+	/// \return Unread bytes.
+	constexpr span<const byte> GetUnreadBytes() const noexcept;
+	
+	C& m_context; ///< Context to read from.
+	vector<shared_ptr<const void>> m_copies; ///< Storage of copied values.
+};
+
+}
+
+#include "view_reader.hpp"
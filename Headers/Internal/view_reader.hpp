@@ -0,0 +1,97 @@
+/// \file
+/// \brief Internal header file that contains implementation of the
+/// view_reader class template.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#pragma once
+
+#include <cstdint>
+
+#include "io_error.h"
+
+namespace std::io
+{
+
+template <input_context C>
+requires Utilities::viewable_stream<typename C::stream_type>
+constexpr view_reader<C>::view_reader(C& ctx) noexcept
+	: m_context{ctx}
+{
+}
+
+template <input_context C>
+requires Utilities::viewable_stream<typename C::stream_type>
+constexpr C& view_reader<C>::get_context() noexcept
+{
+	return m_context;
+}
+
+template <input_context C>
+requires Utilities::viewable_stream<typename C::stream_type>
+constexpr const C& view_reader<C>::get_context() const noexcept
+{
+	return m_context;
+}
+
+template <input_context C>
+requires Utilities::viewable_stream<typename C::stream_type>
+template <typename T>
+requires (!is_const_v<T>) && readable_from<span<T>, C>
+span<const T> view_reader<C>::read(size_t count)
+{
+	Utilities::SkipPadding<T>(m_context);
+	if (is_viewable<T>(count))
+	{
+		return m_context.get_stream().template read_view<T>(count);
+	}
+	// Every value takes at least one byte so reject impossible counts before
+	// allocating.
+	if (count > GetUnreadBytes().size())
+	{
+		throw io_error{"view_reader: Reached end of stream",
+			io_errc::reached_end_of_file};
+	}
+	Utilities::ReserveElements<T>(m_context, count);
+	auto copy = make_shared_for_overwrite<T[]>(count);
+	span<T> values{copy.get(), count};
+	io::read(values, m_context);
+	m_copies.push_back(move(copy));
+	return values;
+}
+
+template <input_context C>
+requires Utilities::viewable_stream<typename C::stream_type>
+template <typename T>
+bool view_reader<C>::is_viewable(size_t count) const noexcept
+{
+	if constexpr (Utilities::bitwise_serializable<T>)
+	{
+		if (!Utilities::IsNativeRepresentation<T>(m_context))
+		{
+			return false;
+		}
+		auto bytes = GetUnreadBytes();
+		if (count > bytes.size() / sizeof(T))
+		{
+			return false;
+		}
+		return reinterpret_cast<uintptr_t>(bytes.data()) % alignof(T) == 0;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+template <input_context C>
+requires Utilities::viewable_stream<typename C::stream_type>
+constexpr span<const byte> view_reader<C>::GetUnreadBytes() const noexcept
+{
+	const auto& s = m_context.get_stream();
+	span<const byte> buffer{s.get_buffer()};
+	auto pos = static_cast<size_t>(s.get_position().value());
+	return buffer.subspan(min(pos, buffer.size()));
+}
+
+}
@@ -5,7 +5,17 @@
 
 #pragma once
 
+#include <array>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
 #include "context_concepts.h"
+#include "aggregate_utilities.h"
+#include "encoding_policy.h"
 
 namespace std::io
 {
@@ -49,9 +59,58 @@ constexpr void write(bool object, output_context auto& ctx);
 
 template <typename T>
 requires integral<T> || is_enum_v<T>
-/*constexpr*/ void write(T object, output_context auto& ctx);
+constexpr void write(T object, output_context auto& ctx);
+
+template <typename T>
+requires integral<T> && (!same_as<remove_const_t<T>, bool>)
+/*constexpr*/ void write(span<T> buffer, output_context auto& ctx);
+
+template <typename T, typename C>
+requires output_context<C> && Utilities::reflectable_aggregate<T> &&
+	(!CustomlyWritableTo<T, C>)
+/*constexpr*/ void write(const T& object, C& ctx);
+
+template <typename T>
+requires floating_point<T>
+/*constexpr*/ void write(span<T> buffer, output_context auto& ctx);
+
+template <typename T, typename C>
+requires output_context<C> &&
+	Utilities::reflectable_aggregate<remove_const_t<T>> &&
+	(!CustomlyWritableTo<remove_const_t<T>, C>)
+/*constexpr*/ void write(span<T> buffer, C& ctx);
+
+template <typename CharT, typename Traits, typename Allocator>
+/*constexpr*/ void write(const basic_string<CharT, Traits, Allocator>& object,
+	output_context auto& ctx);
+
+template <typename T, typename Allocator>
+requires (!same_as<T, byte>) && (!same_as<T, bool>)
+/*constexpr*/ void write(const vector<T, Allocator>& object,
+	output_context auto& ctx);
+
+template <typename T, size_t N>
+requires (!same_as<T, byte>)
+/*constexpr*/ void write(const array<T, N>& object, output_context auto& ctx);
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+/*constexpr*/ void write(const map<Key, T, Compare, Allocator>& object,
+	output_context auto& ctx);
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+	typename Allocator>
+/*constexpr*/ void write(
+	const unordered_map<Key, T, Hash, KeyEqual, Allocator>& object,
+	output_context auto& ctx);
+
+template <typename T>
+/*constexpr*/ void write(const optional<T>& object, output_context auto& ctx);
 
-/*constexpr*/ void write(floating_point auto object, output_context auto& ctx);
+template <typename... Types>
+/*constexpr*/ void write(const variant<Types...>& object,
+	output_context auto& ctx);
+
+constexpr void write(floating_point auto object, output_context auto& ctx);
 
 struct WriteCustomizationPoint
 {
@@ -64,6 +123,25 @@ struct WriteCustomizationPoint
 
 inline constexpr CustomizationPoints::WriteCustomizationPoint write;
 
+namespace Utilities
+{
+
+/// \brief Writes the length prefix of the container using the length prefix
+/// width of the context format.
+/// \param[in] length Length to write.
+/// \param[in,out] ctx Context to write to.
+/// \throw std::io::io_error If length doesn't fit into the length prefix.
+constexpr void WriteLength(size_t length, output_context auto& ctx);
+
+/// \brief Writes the object nested in another object. Byte containers are
+/// written with the length prefix, other objects are written as usual.
+/// \param[in] object Object to write.
+/// \param[in,out] ctx Context to write to.
+template <typename T>
+constexpr void WriteElement(const T& object, output_context auto& ctx);
+
+}
+
 template <typename T, typename O, typename... Args>
 concept writable_to =
 	(output_stream<O> || output_context<O>) &&
@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "write_raw.h"
+#include "varint_utilities.h"
+#include "delta_utilities.h"
 
 namespace std::io
 {
@@ -72,18 +76,313 @@ constexpr void write(bool object, output_context auto& ctx)
 
 template <typename T>
 requires integral<T> || is_enum_v<T>
-/*constexpr*/ void write(T object, output_context auto& ctx)
+constexpr void write(T object, output_context auto& ctx)
 {
+	Utilities::WritePadding<T>(ctx);
+	if constexpr (sizeof(object) > 1)
+	{
+		if (Utilities::GetIntegerFormat<T>(ctx) != integer_format::fixed)
+		{
+			array<byte, Utilities::MaxLEB128Size<T>> buffer;
+			auto size = Utilities::EncodeLEB128(Utilities::ToVarint(object),
+				buffer);
+			write(span<const byte>{buffer}.first(size), ctx);
+			return;
+		}
+	}
 	array<byte, sizeof(object)> buffer;
 	Utilities::FromNative(object, ctx.get_format(), buffer);
 	write(buffer, ctx);
 }
 
-/*constexpr*/ void write(floating_point auto object, output_context auto& ctx)
+template <typename T>
+requires integral<T> && (!same_as<remove_const_t<T>, bool>)
+/*constexpr*/ void write(span<T> buffer, output_context auto& ctx)
 {
-	array<byte, sizeof(object)> buffer;
+	using U = remove_const_t<T>;
+	Utilities::WritePadding<U>(ctx);
+	auto f = ctx.get_format();
+	auto int_format = Utilities::GetIntegerFormat<U>(ctx);
+	if (((sizeof(U) == 1) || (int_format == integer_format::fixed)) &&
+		(f.get_endianness() == endian::native))
+	{
+		write(as_bytes(buffer), ctx);
+		return;
+	}
+	// Encode elements into a staging buffer so that the stream is called once
+	// per chunk instead of once per element.
+	array<byte, 4096> chunk;
+	size_t chunk_size = 0;
+	auto flush_chunk = [&](size_t required_size)
+	{
+		if (chunk.size() - chunk_size < required_size)
+		{
+			write(span<const byte>{chunk}.first(chunk_size), ctx);
+			chunk_size = 0;
+		}
+	};
+	if ((sizeof(U) == 1) || (int_format == integer_format::fixed))
+	{
+		for (auto element : buffer)
+		{
+			flush_chunk(sizeof(U));
+			Utilities::FromNative(element, f,
+				span<byte>{chunk}.subspan(chunk_size, sizeof(U)));
+			chunk_size += sizeof(U);
+		}
+	}
+	else if ((sizeof(U) == sizeof(uint32_t)) &&
+		(int_format == integer_format::group_varint))
+	{
+		array<uint32_t, 4> values;
+		while (!buffer.empty())
+		{
+			auto count = min(buffer.size(), values.size());
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] = static_cast<uint32_t>(Utilities::ToVarint(
+					static_cast<U>(buffer[i])));
+			}
+			flush_chunk(Utilities::MaxGroupVarintSize + 1);
+			chunk_size += Utilities::EncodeGroupVarint(
+				span<const uint32_t>{values}.first(count),
+				span<byte>{chunk}.subspan(chunk_size));
+			buffer = buffer.subspan(count);
+		}
+	}
+	else if ((sizeof(U) == sizeof(uint64_t)) &&
+		(int_format == integer_format::delta_bit_packed))
+	{
+		array<uint64_t, Utilities::DeltaBlockSize> values;
+		uint64_t previous = 0;
+		while (!buffer.empty())
+		{
+			auto count = min(buffer.size(), values.size());
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] = static_cast<uint64_t>(buffer[i]);
+			}
+			flush_chunk(Utilities::MaxDeltaBlockSize);
+			chunk_size += Utilities::EncodeDeltaBlock(
+				span<const uint64_t>{values}.first(count), previous,
+				span<byte>{chunk}.subspan(chunk_size));
+			previous = values[count - 1];
+			buffer = buffer.subspan(count);
+		}
+	}
+	else
+	{
+		for (auto element : buffer)
+		{
+			flush_chunk(Utilities::MaxLEB128Size<U>);
+			chunk_size += Utilities::EncodeLEB128(
+				Utilities::ToVarint(static_cast<U>(element)),
+				span<byte>{chunk}.subspan(chunk_size));
+		}
+	}
+	write(span<const byte>{chunk}.first(chunk_size), ctx);
+}
+
+constexpr void write(floating_point auto object, output_context auto& ctx)
+{
+	Utilities::WritePadding<decltype(object)>(ctx);
+	auto size = Utilities::GetFloatingPointSize<decltype(object)>(
+		ctx.get_format());
+	array<byte, Utilities::MaxFloatingPointSize<decltype(object)>> buffer;
 	Utilities::FromNative(object, ctx.get_format(), buffer);
-	write(buffer, ctx);
+	write(span<const byte>{buffer}.first(size), ctx);
+}
+
+template <typename T>
+requires floating_point<T>
+/*constexpr*/ void write(span<T> buffer, output_context auto& ctx)
+{
+	using U = remove_const_t<T>;
+	Utilities::WritePadding<U>(ctx);
+	if constexpr (Utilities::bitwise_serializable<U>)
+	{
+		if (Utilities::IsNativeRepresentation<U>(ctx))
+		{
+			write(as_bytes(buffer), ctx);
+			return;
+		}
+	}
+	if constexpr (Utilities::iso60559_sane<U>)
+	{
+		// Convert in chunks so that the stream is called once per chunk.
+		auto f = ctx.get_format();
+		auto size = Utilities::GetFloatingPointSize<U>(f);
+		array<byte, 4096> chunk;
+		while (!buffer.empty())
+		{
+			auto count = min(buffer.size(), chunk.size() / size);
+			auto bytes = span<byte>{chunk}.first(size * count);
+			Utilities::FromNativeFloats(span<const U>{buffer.first(count)}, f,
+				bytes);
+			write(span<const byte>{bytes}, ctx);
+			buffer = buffer.subspan(count);
+		}
+	}
+	else
+	{
+		for (auto element : buffer)
+		{
+			write(element, ctx);
+		}
+	}
+}
+
+template <typename T, typename C>
+requires output_context<C> && Utilities::reflectable_aggregate<T> &&
+	(!CustomlyWritableTo<T, C>)
+/*constexpr*/ void write(const T& object, C& ctx)
+{
+	Utilities::WritePadding<T>(ctx);
+	if constexpr (Utilities::bitwise_serializable<T>)
+	{
+		if (Utilities::IsNativeRepresentation<T>(ctx))
+		{
+			write(as_bytes(span<const T, 1>{&object, 1}), ctx);
+			return;
+		}
+	}
+	Utilities::ForEachField(object, [&](const auto& field)
+	{
+		Utilities::WriteElement(field, ctx);
+	});
+}
+
+template <typename T, typename C>
+requires output_context<C> &&
+	Utilities::reflectable_aggregate<remove_const_t<T>> &&
+	(!CustomlyWritableTo<remove_const_t<T>, C>)
+/*constexpr*/ void write(span<T> buffer, C& ctx)
+{
+	using U = remove_const_t<T>;
+	Utilities::WritePadding<U>(ctx);
+	if constexpr (Utilities::bitwise_serializable<U>)
+	{
+		if (Utilities::IsNativeRepresentation<U>(ctx))
+		{
+			write(as_bytes(buffer), ctx);
+			return;
+		}
+	}
+	for (const auto& element : buffer)
+	{
+		write(element, ctx);
+	}
+}
+
+template <typename CharT, typename Traits, typename Allocator>
+/*constexpr*/ void write(const basic_string<CharT, Traits, Allocator>& object,
+	output_context auto& ctx)
+{
+	using C = remove_reference_t<decltype(ctx)>;
+	span<const CharT> buffer{object};
+	if constexpr (Utilities::GetStringEncoding<CharT, C>() ==
+		string_encoding::null_terminated)
+	{
+		if (ranges::find(object, CharT{}) != ranges::end(object))
+		{
+			throw io_error{"write", io_errc::invalid_argument};
+		}
+		write(buffer, ctx);
+		write(CharT{}, ctx);
+	}
+	else
+	{
+		Utilities::WriteLength(ranges::size(object), ctx);
+		write(buffer, ctx);
+	}
+}
+
+template <typename T, typename Allocator>
+requires (!same_as<T, byte>) && (!same_as<T, bool>)
+/*constexpr*/ void write(const vector<T, Allocator>& object,
+	output_context auto& ctx)
+{
+	Utilities::WriteLength(ranges::size(object), ctx);
+	span<const T> buffer{object};
+	if constexpr (requires { write(buffer, ctx); })
+	{
+		write(buffer, ctx);
+	}
+	else
+	{
+		for (const auto& element : object)
+		{
+			Utilities::WriteElement(element, ctx);
+		}
+	}
+}
+
+template <typename T, size_t N>
+requires (!same_as<T, byte>)
+/*constexpr*/ void write(const array<T, N>& object, output_context auto& ctx)
+{
+	// Size is known statically so there is no length prefix.
+	span<const T> buffer{object};
+	if constexpr (requires { write(buffer, ctx); })
+	{
+		write(buffer, ctx);
+	}
+	else
+	{
+		for (const auto& element : object)
+		{
+			Utilities::WriteElement(element, ctx);
+		}
+	}
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+/*constexpr*/ void write(const map<Key, T, Compare, Allocator>& object,
+	output_context auto& ctx)
+{
+	Utilities::WriteLength(ranges::size(object), ctx);
+	for (const auto& [key, value] : object)
+	{
+		Utilities::WriteElement(key, ctx);
+		Utilities::WriteElement(value, ctx);
+	}
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+	typename Allocator>
+/*constexpr*/ void write(
+	const unordered_map<Key, T, Hash, KeyEqual, Allocator>& object,
+	output_context auto& ctx)
+{
+	Utilities::WriteLength(ranges::size(object), ctx);
+	for (const auto& [key, value] : object)
+	{
+		Utilities::WriteElement(key, ctx);
+		Utilities::WriteElement(value, ctx);
+	}
+}
+
+template <typename T>
+/*constexpr*/ void write(const optional<T>& object, output_context auto& ctx)
+{
+	write(object.has_value(), ctx);
+	if (object.has_value())
+	{
+		Utilities::WriteElement(*object, ctx);
+	}
+}
+
+template <typename... Types>
+/*constexpr*/ void write(const variant<Types...>& object,
+	output_context auto& ctx)
+{
+	// Visiting first throws std::bad_variant_access if variant is valueless so
+	// nothing is written in that case.
+	visit([&](const auto& value)
+	{
+		Utilities::WriteLength(object.index(), ctx);
+		Utilities::WriteElement(value, ctx);
+	}, object);
 }
 
 template <typename O, typename... Args>
@@ -94,5 +393,55 @@ constexpr void WriteCustomizationPoint::operator()(const auto& object, O& o,
 	write(object, o, forward<Args>(args)...);
 }
 
+}
+
+namespace Utilities
+{
+
+constexpr void WriteLength(size_t length, output_context auto& ctx)
+{
+	auto write_length = [&]<typename T>(type_identity<T>)
+	{
+		if (length > numeric_limits<T>::max())
+		{
+			throw io_error{"WriteLength", io_errc::value_too_large};
+		}
+		io::write(static_cast<T>(length), ctx);
+	};
+	switch (Utilities::GetLengthPrefixWidth(ctx))
+	{
+		case length_prefix_width::one_byte:
+		{
+			write_length(type_identity<uint8_t>{});
+			return;
+		}
+		case length_prefix_width::two_bytes:
+		{
+			write_length(type_identity<uint16_t>{});
+			return;
+		}
+		case length_prefix_width::four_bytes:
+		{
+			write_length(type_identity<uint32_t>{});
+			return;
+		}
+		default:
+		{
+			write_length(type_identity<uint64_t>{});
+			return;
+		}
+	}
+}
+
+template <typename T>
+constexpr void WriteElement(const T& object, output_context auto& ctx)
+{
+	if constexpr (byte_container<T>)
+	{
+		Utilities::WriteLength(ranges::size(object), ctx);
+	}
+	io::write(object, ctx);
+}
+
 }
 }
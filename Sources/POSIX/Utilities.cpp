@@ -6,8 +6,11 @@
 
 #include <Internal/POSIX/Utilities.h>
 
+#include <limits>
+
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/statvfs.h>
 
 #include <Internal/io_error.h>
@@ -342,4 +345,51 @@ size_t GetBufferSize(NativeHandle handle)
 	return stats.f_bsize;
 }
 
+#if defined(__linux__)
+byte* MapMirroredMemory(size_t size) noexcept
+{
+	auto page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+	if ((size == 0) || (size % page_size != 0) ||
+		(size > numeric_limits<size_t>::max() / 2))
+	{
+		return nullptr;
+	}
+	auto handle = ::memfd_create("ring_buffer", MFD_CLOEXEC);
+	if (handle == -1)
+	{
+		return nullptr;
+	}
+	if (::ftruncate(handle, static_cast<off_t>(size)) == -1)
+	{
+		::close(handle);
+		return nullptr;
+	}
+	// Reserve address space for both mappings and then map the file over it.
+	auto address = ::mmap(nullptr, size * 2, PROT_NONE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (address == MAP_FAILED)
+	{
+		::close(handle);
+		return nullptr;
+	}
+	auto memory = static_cast<byte*>(address);
+	auto first = ::mmap(memory, size, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_FIXED, handle, 0);
+	auto second = ::mmap(memory + size, size, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_FIXED, handle, 0);
+	::close(handle);
+	if ((first == MAP_FAILED) || (second == MAP_FAILED))
+	{
+		::munmap(memory, size * 2);
+		return nullptr;
+	}
+	return memory;
+}
+
+void UnmapMirroredMemory(byte* memory, size_t size) noexcept
+{
+	::munmap(memory, size * 2);
+}
+#endif
+
 }
@@ -0,0 +1,108 @@
+/// \file
+/// \brief Source file that contains implementation of the buffer_pool class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#include <Internal/buffer_pool.h>
+
+#include <bit>
+
+namespace std::io
+{
+
+buffer_pool::buffer_pool(size_t max_buffers_per_class)
+	: m_max_buffers_per_class{max_buffers_per_class}
+{
+}
+
+vector<byte> buffer_pool::acquire(size_t capacity)
+{
+	if (capacity <= max_capacity)
+	{
+		auto index = GetClassIndex(capacity);
+		{
+			lock_guard lock{m_mutex};
+			auto& buffers = m_classes[index];
+			if (!buffers.empty())
+			{
+				auto buffer = move(buffers.back());
+				buffers.pop_back();
+				return buffer;
+			}
+		}
+		// Round up so that the buffer returns to the same size class.
+		capacity = min_capacity << index;
+	}
+	vector<byte> buffer;
+	buffer.reserve(capacity);
+	return buffer;
+}
+
+void buffer_pool::release(vector<byte>&& buffer) noexcept
+{
+	auto capacity = buffer.capacity();
+	if ((capacity < min_capacity) || (capacity > max_capacity))
+	{
+		return;
+	}
+	// Round down so that every buffer in the class is large enough.
+	auto index = static_cast<size_t>(bit_width(capacity / min_capacity)) - 1;
+	buffer.clear();
+	try
+	{
+		lock_guard lock{m_mutex};
+		auto& buffers = m_classes[index];
+		if (buffers.size() < m_max_buffers_per_class)
+		{
+			buffers.push_back(move(buffer));
+		}
+	}
+	catch (...)
+	{
+		// Not enough memory to remember the buffer, just free it.
+	}
+}
+
+size_t buffer_pool::get_free_count() const
+{
+	lock_guard lock{m_mutex};
+	size_t count = 0;
+	for (const auto& buffers : m_classes)
+	{
+		count += buffers.size();
+	}
+	return count;
+}
+
+void buffer_pool::trim() noexcept
+{
+	array<vector<vector<byte>>, ClassCount> classes;
+	{
+		lock_guard lock{m_mutex};
+		classes.swap(m_classes);
+	}
+	// Buffers are freed here, outside of the lock.
+}
+
+buffer_pool& buffer_pool::get_global() noexcept
+{
+	static buffer_pool pool;
+	return pool;
+}
+
+buffer_pool& buffer_pool::get_thread_local() noexcept
+{
+	thread_local buffer_pool pool;
+	return pool;
+}
+
+size_t buffer_pool::GetClassIndex(size_t capacity) noexcept
+{
+	if (capacity <= min_capacity)
+	{
+		return 0;
+	}
+	return static_cast<size_t>(bit_width((capacity - 1) / min_capacity));
+}
+
+}
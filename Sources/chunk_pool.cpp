@@ -0,0 +1,75 @@
+/// \file
+/// \brief Source file that contains implementation of the chunk_pool class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#include <Internal/chunk_pool.h>
+
+#include <Internal/io_error.h>
+
+namespace std::io
+{
+
+chunk_pool::chunk_pool(size_t chunk_size)
+	: m_chunk_size{chunk_size}
+{
+	if (chunk_size == 0)
+	{
+		throw io_error{"chunk_pool", io_errc::invalid_argument};
+	}
+}
+
+size_t chunk_pool::get_chunk_size() const noexcept
+{
+	return m_chunk_size;
+}
+
+unique_ptr<byte[]> chunk_pool::acquire()
+{
+	if (m_free_chunks.empty())
+	{
+		return make_unique_for_overwrite<byte[]>(m_chunk_size);
+	}
+	auto chunk = move(m_free_chunks.back());
+	m_free_chunks.pop_back();
+	return chunk;
+}
+
+void chunk_pool::release(unique_ptr<byte[]> chunk) noexcept
+{
+	if (chunk == nullptr)
+	{
+		return;
+	}
+	try
+	{
+		m_free_chunks.push_back(move(chunk));
+	}
+	catch (...)
+	{
+		// Not enough memory to remember the chunk, just free it.
+	}
+}
+
+size_t chunk_pool::get_free_count() const noexcept
+{
+	return m_free_chunks.size();
+}
+
+void chunk_pool::reserve(size_t count)
+{
+	m_free_chunks.reserve(count);
+	while (m_free_chunks.size() < count)
+	{
+		m_free_chunks.push_back(make_unique_for_overwrite<byte[]>(
+			m_chunk_size));
+	}
+}
+
+void chunk_pool::trim() noexcept
+{
+	m_free_chunks.clear();
+	m_free_chunks.shrink_to_fit();
+}
+
+}
@@ -0,0 +1,205 @@
+/// \file
+/// \brief Source file that contains implementation of the
+/// chunked_memory_stream class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#include <Internal/chunked_memory_stream.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include <Internal/io_error.h>
+
+namespace std::io
+{
+
+chunked_memory_stream::chunked_memory_stream(size_t chunk_size)
+	: m_pool{nullptr},
+	m_chunk_size{chunk_size},
+	m_size{0}
+{
+	if (chunk_size == 0)
+	{
+		throw io_error{"chunked_memory_stream", io_errc::invalid_argument};
+	}
+}
+
+chunked_memory_stream::chunked_memory_stream(chunk_pool& pool) noexcept
+	: m_pool{&pool},
+	m_chunk_size{pool.get_chunk_size()},
+	m_size{0}
+{
+}
+
+chunked_memory_stream::chunked_memory_stream(chunked_memory_stream&& other)
+	noexcept
+	: PositionHelper{other},
+	m_pool{other.m_pool},
+	m_chunk_size{other.m_chunk_size},
+	m_chunks{move(other.m_chunks)},
+	m_size{exchange(other.m_size, 0)}
+{
+	other.m_chunks.clear();
+	other.m_position = 0;
+}
+
+chunked_memory_stream::~chunked_memory_stream()
+{
+	this->ReleaseChunks();
+}
+
+chunked_memory_stream& chunked_memory_stream::operator=(
+	chunked_memory_stream&& other) noexcept
+{
+	if (this == &other)
+	{
+		return *this;
+	}
+	this->ReleaseChunks();
+	m_position = exchange(other.m_position, 0);
+	m_pool = other.m_pool;
+	m_chunk_size = other.m_chunk_size;
+	m_chunks = move(other.m_chunks);
+	other.m_chunks.clear();
+	m_size = exchange(other.m_size, 0);
+	return *this;
+}
+
+streamsize chunked_memory_stream::read_some(span<byte> buffer)
+{
+	if (buffer.empty())
+	{
+		return 0;
+	}
+	auto pos = static_cast<size_t>(m_position);
+	if (pos >= m_size)
+	{
+		// Already at the end of stream.
+		return 0;
+	}
+	auto bytes_to_read = min({buffer.size(), m_size - pos,
+		static_cast<size_t>(numeric_limits<streamsize>::max())});
+	this->ForEachChunk(pos, pos + bytes_to_read,
+		[&](span<byte> chunk, size_t offset)
+	{
+		memcpy(buffer.data() + offset, chunk.data(), chunk.size());
+	});
+	m_position += static_cast<streamoff>(bytes_to_read);
+	return static_cast<streamsize>(bytes_to_read);
+}
+
+streamsize chunked_memory_stream::write_some(span<const byte> buffer)
+{
+	if (buffer.empty())
+	{
+		return 0;
+	}
+	if (m_position == position::max().value())
+	{
+		// Already at the maximum position supported by the implementation.
+		throw io_error{"write_some", io_errc::file_too_large};
+	}
+	auto pos = static_cast<size_t>(m_position);
+	auto bytes_to_write = min({buffer.size(),
+		static_cast<size_t>(position::max().value() - m_position),
+		static_cast<size_t>(numeric_limits<streamsize>::max())});
+	auto end_position = pos + bytes_to_write;
+	this->AddChunks(end_position);
+	if (pos > m_size)
+	{
+		// Chunks may hold stale bytes, zero the gap left by seeking.
+		this->ForEachChunk(m_size, pos, [](span<byte> chunk, size_t)
+		{
+			ranges::fill(chunk, byte{0});
+		});
+	}
+	this->ForEachChunk(pos, end_position, [&](span<byte> chunk, size_t offset)
+	{
+		memcpy(chunk.data(), buffer.data() + offset, chunk.size());
+	});
+	m_size = max(m_size, end_position);
+	m_position = static_cast<streamoff>(end_position);
+	return static_cast<streamsize>(bytes_to_write);
+}
+
+size_t chunked_memory_stream::get_size() const noexcept
+{
+	return m_size;
+}
+
+size_t chunked_memory_stream::get_chunk_size() const noexcept
+{
+	return m_chunk_size;
+}
+
+vector<span<const byte>> chunked_memory_stream::get_chunks() const
+{
+	vector<span<const byte>> chunks;
+	chunks.reserve(m_chunks.size());
+	this->ForEachChunk(0, m_size, [&](span<byte> chunk, size_t)
+	{
+		chunks.push_back(chunk);
+	});
+	return chunks;
+}
+
+void chunked_memory_stream::reset_buffer() noexcept
+{
+	this->ReleaseChunks();
+	m_size = 0;
+	m_position = 0;
+}
+
+void chunked_memory_stream::AddChunks(size_t size)
+{
+	auto required_count = size / m_chunk_size + ((size % m_chunk_size) != 0);
+	while (m_chunks.size() < required_count)
+	{
+		auto chunk = (m_pool != nullptr) ? m_pool->acquire() :
+			make_unique_for_overwrite<byte[]>(m_chunk_size);
+		try
+		{
+			m_chunks.push_back(move(chunk));
+		}
+		catch (...)
+		{
+			if (m_pool != nullptr)
+			{
+				m_pool->release(move(chunk));
+			}
+			throw;
+		}
+	}
+}
+
+template <typename F>
+void chunked_memory_stream::ForEachChunk(size_t first, size_t last, F f) const
+{
+	auto offset = size_t{0};
+	while (first < last)
+	{
+		auto index = first / m_chunk_size;
+		auto chunk_offset = first % m_chunk_size;
+		auto size = min(m_chunk_size - chunk_offset, last - first);
+		f(span<byte>{m_chunks[index].get() + chunk_offset, size}, offset);
+		first += size;
+		offset += size;
+	}
+}
+
+void chunked_memory_stream::ReleaseChunks() noexcept
+{
+	if (m_pool != nullptr)
+	{
+		for (auto& chunk : m_chunks)
+		{
+			m_pool->release(move(chunk));
+		}
+	}
+	m_chunks.clear();
+}
+
+}
@@ -0,0 +1,166 @@
+/// \file
+/// \brief Source file that contains implementation of the
+/// copy_on_write_memory_stream class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#include <Internal/copy_on_write_memory_stream.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+#include <Internal/io_error.h>
+
+namespace std::io
+{
+
+copy_on_write_memory_stream::copy_on_write_memory_stream(size_t chunk_size)
+	: m_chunk_size{chunk_size},
+	m_size{0}
+{
+	if (chunk_size == 0)
+	{
+		throw io_error{"copy_on_write_memory_stream",
+			io_errc::invalid_argument};
+	}
+}
+
+streamsize copy_on_write_memory_stream::read_some(span<byte> buffer)
+{
+	if (buffer.empty())
+	{
+		return 0;
+	}
+	auto pos = static_cast<size_t>(m_position);
+	if (pos >= m_size)
+	{
+		// Already at the end of stream.
+		return 0;
+	}
+	auto bytes_to_read = min({buffer.size(), m_size - pos,
+		static_cast<size_t>(numeric_limits<streamsize>::max())});
+	this->ForEachChunk(pos, pos + bytes_to_read, [&](size_t index,
+		size_t chunk_offset, size_t size, size_t offset)
+	{
+		memcpy(buffer.data() + offset, m_chunks[index].get() + chunk_offset,
+			size);
+	});
+	m_position += static_cast<streamoff>(bytes_to_read);
+	return static_cast<streamsize>(bytes_to_read);
+}
+
+streamsize copy_on_write_memory_stream::write_some(span<const byte> buffer)
+{
+	if (buffer.empty())
+	{
+		return 0;
+	}
+	if (m_position == position::max().value())
+	{
+		// Already at the maximum position supported by the implementation.
+		throw io_error{"write_some", io_errc::file_too_large};
+	}
+	auto pos = static_cast<size_t>(m_position);
+	auto bytes_to_write = min({buffer.size(),
+		static_cast<size_t>(position::max().value() - m_position),
+		static_cast<size_t>(numeric_limits<streamsize>::max())});
+	auto end_position = pos + bytes_to_write;
+	auto required_count = end_position / m_chunk_size +
+		((end_position % m_chunk_size) != 0);
+	m_chunks.reserve(required_count);
+	while (m_chunks.size() < required_count)
+	{
+		m_chunks.push_back(make_shared_for_overwrite<byte[]>(m_chunk_size));
+	}
+	if (pos > m_size)
+	{
+		// New chunks hold stale bytes, zero the gap left by seeking.
+		this->ForEachChunk(m_size, pos, [&](size_t index, size_t chunk_offset,
+			size_t size, size_t)
+		{
+			memset(this->GetWritableChunk(index) + chunk_offset, 0, size);
+		});
+	}
+	this->ForEachChunk(pos, end_position, [&](size_t index,
+		size_t chunk_offset, size_t size, size_t offset)
+	{
+		memcpy(this->GetWritableChunk(index) + chunk_offset,
+			buffer.data() + offset, size);
+	});
+	m_size = max(m_size, end_position);
+	m_position = static_cast<streamoff>(end_position);
+	return static_cast<streamsize>(bytes_to_write);
+}
+
+size_t copy_on_write_memory_stream::get_size() const noexcept
+{
+	return m_size;
+}
+
+size_t copy_on_write_memory_stream::get_chunk_size() const noexcept
+{
+	return m_chunk_size;
+}
+
+vector<span<const byte>> copy_on_write_memory_stream::get_chunks() const
+{
+	vector<span<const byte>> chunks;
+	chunks.reserve(m_chunks.size());
+	this->ForEachChunk(0, m_size, [&](size_t index, size_t, size_t size,
+		size_t)
+	{
+		chunks.emplace_back(m_chunks[index].get(), size);
+	});
+	return chunks;
+}
+
+copy_on_write_memory_stream copy_on_write_memory_stream::snapshot() const
+{
+	return *this;
+}
+
+void copy_on_write_memory_stream::reset_buffer() noexcept
+{
+	m_chunks.clear();
+	m_size = 0;
+	m_position = 0;
+}
+
+template <typename F>
+void copy_on_write_memory_stream::ForEachChunk(size_t first, size_t last, F f)
+	const
+{
+	auto offset = size_t{0};
+	while (first < last)
+	{
+		auto index = first / m_chunk_size;
+		auto chunk_offset = first % m_chunk_size;
+		auto size = min(m_chunk_size - chunk_offset, last - first);
+		f(index, chunk_offset, size, offset);
+		first += size;
+		offset += size;
+	}
+}
+
+byte* copy_on_write_memory_stream::GetWritableChunk(size_t index)
+{
+	auto& chunk = m_chunks[index];
+	if (chunk.use_count() == 1)
+	{
+		// Pairs with the release of the last other owner so that its reads
+		// happen before our writes.
+		atomic_thread_fence(memory_order_acquire);
+		return chunk.get();
+	}
+	auto first = index * m_chunk_size;
+	auto valid_size = (m_size > first) ? min(m_chunk_size, m_size - first) :
+		size_t{0};
+	auto copy = make_shared_for_overwrite<byte[]>(m_chunk_size);
+	memcpy(copy.get(), chunk.get(), valid_size);
+	chunk = move(copy);
+	return chunk.get();
+}
+
+}
@@ -0,0 +1,49 @@
+/// \file
+/// \brief Source file that contains implementation of the
+/// input_shared_buffer_stream class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#include <Internal/input_shared_buffer_stream.h>
+
+#include <Internal/stream_utilities.h>
+
+namespace std::io
+{
+
+input_shared_buffer_stream::input_shared_buffer_stream(shared_buffer buffer)
+	noexcept
+	: m_buffer{move(buffer)}
+{
+}
+
+streamsize input_shared_buffer_stream::read_some(span<byte> buffer)
+{
+	return Utilities::ReadSome(m_buffer, m_position, buffer);
+}
+
+shared_buffer input_shared_buffer_stream::read_slice(size_t count)
+{
+	auto bytes = Utilities::ReadViewBytes(m_buffer, m_position, count, 1);
+	return m_buffer.subslice(static_cast<size_t>(bytes.data() -
+		m_buffer.data()), bytes.size());
+}
+
+const shared_buffer& input_shared_buffer_stream::get_buffer() const noexcept
+{
+	return m_buffer;
+}
+
+void input_shared_buffer_stream::set_buffer(shared_buffer new_buffer) noexcept
+{
+	m_buffer = move(new_buffer);
+	m_position = 0;
+}
+
+void input_shared_buffer_stream::reset_buffer() noexcept
+{
+	m_buffer = {};
+	m_position = 0;
+}
+
+}
@@ -0,0 +1,245 @@
+/// \file
+/// \brief Source file that contains implementation of the ring_buffer_stream
+/// class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#include <Internal/ring_buffer_stream.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include <Internal/io_error.h>
+
+#include "Utilities.h"
+
+namespace std::io
+{
+
+ring_buffer_stream::ring_buffer_stream(size_t capacity,
+	ring_buffer_mapping mapping, ring_buffer_mode mode)
+	: m_buffer{nullptr},
+	m_capacity{capacity},
+	m_mirrored{false},
+	m_mode{mode},
+	m_closed{false},
+	m_read_index{0},
+	m_write_index{0}
+{
+	if (!has_single_bit(capacity))
+	{
+		throw io_error{"ring_buffer_stream", io_errc::invalid_argument};
+	}
+#if defined(__linux__)
+	if (mapping == ring_buffer_mapping::mirrored)
+	{
+		m_buffer = Platform::MapMirroredMemory(capacity);
+		m_mirrored = (m_buffer != nullptr);
+	}
+#else
+	static_cast<void>(mapping);
+#endif
+	if (m_buffer == nullptr)
+	{
+		m_buffer = static_cast<byte*>(::operator new(capacity,
+			align_val_t{CacheLineSize}));
+	}
+}
+
+ring_buffer_stream::~ring_buffer_stream()
+{
+#if defined(__linux__)
+	if (m_mirrored)
+	{
+		Platform::UnmapMirroredMemory(m_buffer, m_capacity);
+		return;
+	}
+#endif
+	::operator delete(m_buffer, align_val_t{CacheLineSize});
+}
+
+streamsize ring_buffer_stream::read_some(span<byte> buffer)
+{
+	if (buffer.empty())
+	{
+		return 0;
+	}
+	if (m_mode == ring_buffer_mode::blocking)
+	{
+		while (true)
+		{
+			// Check the flag first so that bytes written before closing are
+			// not missed.
+			auto closed = m_closed.load(memory_order_acquire);
+			if (closed || !this->get_readable_bytes().empty())
+			{
+				break;
+			}
+			this_thread::yield();
+		}
+	}
+	return static_cast<streamsize>(this->ReadAvailable(buffer));
+}
+
+bool ring_buffer_stream::try_read(span<byte> buffer)
+{
+	if (this->get_size() < buffer.size())
+	{
+		return false;
+	}
+	this->ReadAvailable(buffer);
+	return true;
+}
+
+span<const byte> ring_buffer_stream::get_readable_bytes() const noexcept
+{
+	auto read_index = m_read_index.load(memory_order_relaxed);
+	auto write_index = m_write_index.load(memory_order_acquire);
+	return this->GetRegion(read_index, write_index - read_index);
+}
+
+void ring_buffer_stream::commit_read(size_t count) noexcept
+{
+	auto read_index = m_read_index.load(memory_order_relaxed);
+	m_read_index.store(read_index + count, memory_order_release);
+}
+
+streamsize ring_buffer_stream::write_some(span<const byte> buffer)
+{
+	if (buffer.empty())
+	{
+		return 0;
+	}
+	if (this->is_closed())
+	{
+		throw io_error{"write_some", io_errc::bad_file_descriptor};
+	}
+	if (m_mode == ring_buffer_mode::blocking)
+	{
+		while (this->get_writable_bytes().empty())
+		{
+			this_thread::yield();
+		}
+	}
+	auto bytes_written = this->WriteAvailable(buffer);
+	if (bytes_written == 0)
+	{
+		throw io_error{"write_some", io_errc::file_too_large};
+	}
+	return static_cast<streamsize>(bytes_written);
+}
+
+bool ring_buffer_stream::try_write(span<const byte> buffer)
+{
+	if (this->is_closed())
+	{
+		throw io_error{"try_write", io_errc::bad_file_descriptor};
+	}
+	if (m_capacity - this->get_size() < buffer.size())
+	{
+		return false;
+	}
+	this->WriteAvailable(buffer);
+	return true;
+}
+
+span<byte> ring_buffer_stream::get_writable_bytes() const noexcept
+{
+	auto write_index = m_write_index.load(memory_order_relaxed);
+	auto read_index = m_read_index.load(memory_order_acquire);
+	return this->GetRegion(write_index,
+		m_capacity - (write_index - read_index));
+}
+
+void ring_buffer_stream::commit_write(size_t count) noexcept
+{
+	auto write_index = m_write_index.load(memory_order_relaxed);
+	m_write_index.store(write_index + count, memory_order_release);
+}
+
+void ring_buffer_stream::close() noexcept
+{
+	m_closed.store(true, memory_order_release);
+}
+
+bool ring_buffer_stream::is_closed() const noexcept
+{
+	return m_closed.load(memory_order_acquire);
+}
+
+size_t ring_buffer_stream::get_capacity() const noexcept
+{
+	return m_capacity;
+}
+
+size_t ring_buffer_stream::get_size() const noexcept
+{
+	// Load the read index first so that it never passes the write index.
+	auto read_index = m_read_index.load(memory_order_acquire);
+	auto write_index = m_write_index.load(memory_order_acquire);
+	return write_index - read_index;
+}
+
+bool ring_buffer_stream::is_mirrored() const noexcept
+{
+	return m_mirrored;
+}
+
+ring_buffer_mode ring_buffer_stream::get_mode() const noexcept
+{
+	return m_mode;
+}
+
+span<byte> ring_buffer_stream::GetRegion(size_t index, size_t count) const
+	noexcept
+{
+	auto offset = index & (m_capacity - 1);
+	if (!m_mirrored)
+	{
+		count = min(count, m_capacity - offset);
+	}
+	return {m_buffer + offset, count};
+}
+
+size_t ring_buffer_stream::ReadAvailable(span<byte> buffer) noexcept
+{
+	auto bytes = this->get_readable_bytes();
+	auto bytes_to_read = min(bytes.size(), buffer.size());
+	if (bytes_to_read == 0)
+	{
+		return 0;
+	}
+	memcpy(buffer.data(), bytes.data(), bytes_to_read);
+	this->commit_read(bytes_to_read);
+	if ((bytes_to_read < buffer.size()) && !m_mirrored)
+	{
+		// Readable bytes may continue at the start of the buffer.
+		return bytes_to_read + this->ReadAvailable(
+			buffer.subspan(bytes_to_read));
+	}
+	return bytes_to_read;
+}
+
+size_t ring_buffer_stream::WriteAvailable(span<const byte> buffer) noexcept
+{
+	auto bytes = this->get_writable_bytes();
+	auto bytes_to_write = min(bytes.size(), buffer.size());
+	if (bytes_to_write == 0)
+	{
+		return 0;
+	}
+	memcpy(bytes.data(), buffer.data(), bytes_to_write);
+	this->commit_write(bytes_to_write);
+	if ((bytes_to_write < buffer.size()) && !m_mirrored)
+	{
+		// Free space may continue at the start of the buffer.
+		return bytes_to_write + this->WriteAvailable(
+			buffer.subspan(bytes_to_write));
+	}
+	return bytes_to_write;
+}
+
+}
@@ -0,0 +1,88 @@
+/// \file
+/// \brief Source file that contains implementation of the shared_buffer class.
+/// \author Lyberta
+/// \copyright BSLv1.
+
+#include <Internal/shared_buffer.h>
+
+#include <Internal/io_error.h>
+
+namespace std::io
+{
+
+shared_buffer::shared_buffer(vector<byte>&& bytes)
+	: m_size{bytes.size()}
+{
+	if (bytes.empty())
+	{
+		return;
+	}
+	// Keep the vector alive and point to its bytes so that they are not
+	// copied.
+	auto owner = make_shared<const vector<byte>>(move(bytes));
+	m_data = shared_ptr<const byte>{owner, owner->data()};
+}
+
+shared_buffer::shared_buffer(span<const byte> bytes)
+	: shared_buffer{vector<byte>(bytes.begin(), bytes.end())}
+{
+}
+
+shared_buffer::const_iterator shared_buffer::begin() const noexcept
+{
+	return m_data.get();
+}
+
+shared_buffer::const_iterator shared_buffer::end() const noexcept
+{
+	return m_data.get() + m_size;
+}
+
+bool shared_buffer::empty() const noexcept
+{
+	return m_size == 0;
+}
+
+shared_buffer::size_type shared_buffer::size() const noexcept
+{
+	return m_size;
+}
+
+shared_buffer::const_reference shared_buffer::operator[](size_type index)
+	const noexcept
+{
+	return m_data.get()[index];
+}
+
+shared_buffer::const_pointer shared_buffer::data() const noexcept
+{
+	return m_data.get();
+}
+
+span<const byte> shared_buffer::get_bytes() const noexcept
+{
+	return {m_data.get(), m_size};
+}
+
+shared_buffer shared_buffer::subslice(size_type offset, size_type count) const
+{
+	if (offset > m_size)
+	{
+		throw io_error{"shared_buffer::subslice", io_errc::invalid_argument};
+	}
+	count = min(count, m_size - offset);
+	shared_buffer result;
+	if (count != 0)
+	{
+		result.m_data = shared_ptr<const byte>{m_data, m_data.get() + offset};
+		result.m_size = count;
+	}
+	return result;
+}
+
+long shared_buffer::get_use_count() const noexcept
+{
+	return m_data.use_count();
+}
+
+}
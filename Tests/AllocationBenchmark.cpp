@@ -0,0 +1,182 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <io>
+#include <experimental/random>
+
+namespace
+{
+
+std::size_t allocation_count = 0;
+
+}
+
+void* operator new(std::size_t size)
+{
+	++allocation_count;
+	if (auto pointer = std::malloc(size == 0 ? 1 : size))
+	{
+		return pointer;
+	}
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+struct message
+{
+	std::uint64_t id;
+	std::uint32_t flags;
+	std::vector<std::uint64_t> values;
+	
+	template <std::io::output_context C>
+	void write(C& ctx) const
+	{
+		std::io::write(id, ctx);
+		std::io::write(flags, ctx);
+		std::io::write(values, ctx);
+	}
+};
+
+class output_memory_stream_bench final
+{
+	std::size_t m_total_size = 0;
+public:
+	constexpr static std::string_view name =
+		"std::io::output_memory_stream";
+	
+	void Run(const std::vector<message>& messages)
+	{
+		for (const auto& m : messages)
+		{
+			std::io::output_memory_stream stream;
+			std::io::default_context context{stream};
+			std::io::write(m, context);
+			m_total_size += stream.get_buffer().size();
+		}
+	}
+};
+
+class pmr_output_memory_stream_bench final
+{
+	std::array<std::byte, 16384> m_storage;
+	std::size_t m_total_size = 0;
+public:
+	constexpr static std::string_view name =
+		"std::io::pmr::output_memory_stream";
+	
+	void Run(const std::vector<message>& messages)
+	{
+		std::pmr::monotonic_buffer_resource arena{m_storage.data(),
+			m_storage.size()};
+		for (const auto& m : messages)
+		{
+			{
+				std::io::pmr::output_memory_stream stream{&arena};
+				std::io::default_context context{stream};
+				std::io::write(m, context);
+				m_total_size += stream.get_buffer().size();
+			}
+			// Release the whole request at once.
+			arena.release();
+		}
+	}
+};
+
+class small_output_memory_stream_bench final
+{
+	std::size_t m_total_size = 0;
+public:
+	constexpr static std::string_view name =
+		"std::io::small_output_memory_stream";
+	
+	void Run(const std::vector<message>& messages)
+	{
+		for (const auto& m : messages)
+		{
+			std::io::small_output_memory_stream stream;
+			std::io::default_context context{stream};
+			std::io::write(m, context);
+			m_total_size += stream.get_buffer().size();
+		}
+	}
+};
+
+class pooled_output_memory_stream_bench final
+{
+	std::size_t m_total_size = 0;
+public:
+	constexpr static std::string_view name =
+		"Pooled std::io::output_memory_stream";
+	
+	void Run(const std::vector<message>& messages)
+	{
+		auto& pool = std::io::buffer_pool::get_thread_local();
+		std::io::output_memory_stream stream;
+		std::io::default_context context{stream};
+		for (const auto& m : messages)
+		{
+			stream.set_buffer(pool, std::io::buffer_pool::min_capacity);
+			std::io::write(m, context);
+			m_total_size += stream.get_buffer().size();
+			stream.reset_buffer(pool);
+		}
+	}
+};
+
+template <typename B>
+void Benchmark(const auto& data)
+{
+	std::cout << B::name;
+	B b;
+	auto start_allocation_count = allocation_count;
+	auto start_time = std::chrono::high_resolution_clock::now();
+	try
+	{
+		b.Run(data);
+	}
+	catch (std::exception& e)
+	{
+		std::cout << ": FAILED\n";
+		std::cout << "Reason: " << e.what() << '\n';
+		return;
+	}
+	catch (...)
+	{
+		std::cout << ": FAILED\n";
+		std::cout << "Reason: Unknown exception.\n";
+		return;
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double, std::milli> time_elapsed = end_time -
+		start_time;
+	std::cout << ": " << time_elapsed.count() << " ms, " <<
+		(allocation_count - start_allocation_count) << " allocations\n";
+}
+
+int main()
+{
+	std::vector<message> messages;
+	messages.resize(1'000'000);
+	for (auto&& m : messages)
+	{
+		m.id = std::experimental::randint<std::uint64_t>(
+			std::numeric_limits<std::uint64_t>::min(),
+			std::numeric_limits<std::uint64_t>::max());
+		m.flags = std::experimental::randint<std::uint32_t>(0, 255);
+		m.values.resize(std::experimental::randint(0, 16));
+	}
+	Benchmark<output_memory_stream_bench>(messages);
+	Benchmark<pmr_output_memory_stream_bench>(messages);
+	Benchmark<small_output_memory_stream_bench>(messages);
+	Benchmark<pooled_output_memory_stream_bench>(messages);
+}
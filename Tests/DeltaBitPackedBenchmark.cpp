@@ -0,0 +1,129 @@
+#include <iostream>
+#include <chrono>
+#include <io>
+#include <experimental/random>
+
+constexpr std::size_t value_count = 1 << 22;
+constexpr std::size_t iterations = 8;
+
+std::vector<std::uint64_t> MakeTimestamps()
+{
+	std::vector<std::uint64_t> result(value_count);
+	std::uint64_t timestamp = 1'600'000'000'000;
+	for (auto& value : result)
+	{
+		timestamp += static_cast<std::uint64_t>(
+			std::experimental::randint(0, 4095));
+		value = timestamp;
+	}
+	return result;
+}
+
+std::io::format MakeFormat(std::io::integer_format f)
+{
+	return {std::endian::little, std::io::floating_point_format::native, f};
+}
+
+std::vector<std::byte> Encode(const std::vector<std::uint64_t>& values,
+	std::io::integer_format f)
+{
+	std::io::output_memory_stream stream;
+	std::io::default_context context{stream, MakeFormat(f)};
+	std::io::write(values, context);
+	return std::move(stream).get_buffer();
+}
+
+void Benchmark(std::string_view name, const std::vector<std::uint64_t>& values,
+	std::io::integer_format f, std::size_t fixed_size)
+{
+	auto data = Encode(values, f);
+	std::cout << name << ": " << data.size() << " bytes ("
+		<< static_cast<double>(fixed_size) / static_cast<double>(data.size())
+		<< "x smaller than fixed)";
+	std::vector<std::uint64_t> result;
+	auto start_time = std::chrono::high_resolution_clock::now();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		std::io::input_span_stream stream{data};
+		std::io::default_context context{stream, MakeFormat(f)};
+		std::io::read(result, context);
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	if (result != values)
+	{
+		std::cout << ": FAILED\n";
+		return;
+	}
+	std::chrono::duration<double> time_elapsed = end_time - start_time;
+	auto decoded_bytes = static_cast<double>(values.size() *
+		sizeof(std::uint64_t) * iterations);
+	std::cout << ", read: " << time_elapsed.count() * 1000 / iterations
+		<< " ms, " << decoded_bytes / time_elapsed.count() / 1e9 << " GB/s\n";
+}
+
+// Decodes blocks from memory without the stream and the context to measure
+// unpacking and prefix summing alone.
+void BenchmarkBlocks(const std::vector<std::uint64_t>& values)
+{
+	namespace u = std::io::Utilities;
+	constexpr auto block_size = u::MaxDeltaBlockSize + u::UnpackBitsPadding;
+	auto block_count = values.size() / u::DeltaBlockSize;
+	std::vector<std::byte> blocks(block_count * block_size);
+	std::uint64_t previous = 0;
+	for (std::size_t i = 0; i < block_count; ++i)
+	{
+		auto block = std::span{values}.subspan(i * u::DeltaBlockSize,
+			u::DeltaBlockSize);
+		u::EncodeDeltaBlock(block, previous, std::span{blocks}.subspan(
+			i * block_size, block_size));
+		previous = block.back();
+	}
+	std::vector<std::uint64_t> result(block_count * u::DeltaBlockSize);
+	auto start_time = std::chrono::high_resolution_clock::now();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		previous = 0;
+		for (std::size_t j = 0; j < block_count; ++j)
+		{
+			std::span<const std::byte> data{blocks.data() + j * block_size,
+				block_size};
+			auto out = std::span{result}.subspan(j * u::DeltaBlockSize,
+				u::DeltaBlockSize);
+			std::uint64_t minimum;
+			auto size = u::DecodeLEB128(data, minimum);
+			auto width = std::to_integer<int>(data[size]);
+			if (width == 0)
+			{
+				std::ranges::fill(out, 0);
+			}
+			else
+			{
+				u::UnpackBits(data.subspan(size + 1), 0, width, out);
+			}
+			u::DecodeDeltas(out, minimum, previous);
+			previous = out.back();
+		}
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	if (!std::ranges::equal(result, std::span{values}.first(result.size())))
+	{
+		std::cout << "delta_bit_packed blocks: FAILED\n";
+		return;
+	}
+	std::chrono::duration<double> time_elapsed = end_time - start_time;
+	auto decoded_bytes = static_cast<double>(result.size() *
+		sizeof(std::uint64_t) * iterations);
+	std::cout << "delta_bit_packed blocks: "
+		<< decoded_bytes / time_elapsed.count() / 1e9 << " GB/s\n";
+}
+
+int main()
+{
+	auto values = MakeTimestamps();
+	auto fixed_size = values.size() * sizeof(std::uint64_t);
+	Benchmark("fixed", values, std::io::integer_format::fixed, fixed_size);
+	Benchmark("leb128", values, std::io::integer_format::leb128, fixed_size);
+	Benchmark("delta_bit_packed", values,
+		std::io::integer_format::delta_bit_packed, fixed_size);
+	BenchmarkBlocks(values);
+}
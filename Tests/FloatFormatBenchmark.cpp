@@ -0,0 +1,143 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <io>
+#include <experimental/random>
+
+constexpr std::size_t value_count = 1 << 20;
+constexpr std::size_t iterations = 8;
+
+std::string_view GetName(std::io::floating_point_format f)
+{
+	switch (f)
+	{
+		case std::io::floating_point_format::iec559:
+		{
+			return "iec559";
+		}
+		case std::io::floating_point_format::ibm_hexadecimal:
+		{
+			return "ibm_hexadecimal";
+		}
+		case std::io::floating_point_format::vax:
+		{
+			return "vax";
+		}
+		case std::io::floating_point_format::binary128:
+		{
+			return "binary128";
+		}
+		default:
+		{
+			return "x87_extended";
+		}
+	}
+}
+
+std::vector<std::byte> MakeBytes(std::size_t size)
+{
+	std::vector<std::byte> result(size);
+	for (auto& value : result)
+	{
+		value = static_cast<std::byte>(std::experimental::randint(0, 255));
+	}
+	return result;
+}
+
+template <typename T>
+std::vector<T> MakeValues()
+{
+	std::vector<T> result(value_count);
+	for (auto& value : result)
+	{
+		value = static_cast<T>(std::experimental::randint(-1'000'000,
+			1'000'000)) / static_cast<T>(std::experimental::randint(1, 1000));
+	}
+	return result;
+}
+
+template <typename T>
+bool IsSame(std::span<const T> lhs, std::span<const T> rhs)
+{
+	return std::memcmp(lhs.data(), rhs.data(), lhs.size_bytes()) == 0;
+}
+
+// Bulk conversion must produce the same bits as converting one value at a
+// time. Random bytes cover every encoding, including the invalid ones.
+template <typename T>
+bool Benchmark(std::string_view type_name, std::io::floating_point_format f)
+{
+	namespace u = std::io::Utilities;
+	std::io::format fmt{std::endian::big, f};
+	auto size = u::GetFloatingPointSize<T>(fmt);
+	auto data = MakeBytes(value_count * size);
+	std::vector<T> expected(value_count);
+	for (std::size_t i = 0; i < value_count; ++i)
+	{
+		u::ToNative(std::span<const std::byte>{data}.subspan(i * size, size),
+			fmt, expected[i]);
+	}
+	std::vector<T> result(value_count);
+	auto start_time = std::chrono::high_resolution_clock::now();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		std::io::input_span_stream stream{data};
+		std::io::default_context context{stream, fmt};
+		std::span<T> buffer{result};
+		std::io::read(buffer, context);
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	std::cout << type_name << ", " << GetName(f);
+	if (!IsSame<T>(result, expected))
+	{
+		std::cout << ": read FAILED\n";
+		return false;
+	}
+	std::chrono::duration<double> time_elapsed = end_time - start_time;
+	auto decoded_bytes = static_cast<double>(value_count * sizeof(T) *
+		iterations);
+	std::cout << ", read: " << decoded_bytes / time_elapsed.count() / 1e9
+		<< " GB/s";
+
+	auto values = MakeValues<T>();
+	std::vector<std::byte> expected_bytes(value_count * size);
+	for (std::size_t i = 0; i < value_count; ++i)
+	{
+		u::FromNative(values[i], fmt, std::span{expected_bytes}.subspan(
+			i * size, size));
+	}
+	std::io::output_memory_stream stream;
+	start_time = std::chrono::high_resolution_clock::now();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		stream.seek_position(std::io::position{0});
+		std::io::default_context context{stream, fmt};
+		std::io::write(std::span<const T>{values}, context);
+	}
+	end_time = std::chrono::high_resolution_clock::now();
+	if (stream.get_buffer() != expected_bytes)
+	{
+		std::cout << ", write FAILED\n";
+		return false;
+	}
+	time_elapsed = end_time - start_time;
+	std::cout << ", write: " << decoded_bytes / time_elapsed.count() / 1e9
+		<< " GB/s\n";
+	return true;
+}
+
+int main()
+{
+	bool success = true;
+	for (auto f : {std::io::floating_point_format::iec559,
+		std::io::floating_point_format::ibm_hexadecimal,
+		std::io::floating_point_format::vax,
+		std::io::floating_point_format::binary128,
+		std::io::floating_point_format::x87_extended})
+	{
+		success &= Benchmark<float>("float", f);
+		success &= Benchmark<double>("double", f);
+	}
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
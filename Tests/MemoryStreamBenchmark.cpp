@@ -0,0 +1,135 @@
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <io>
+#include <experimental/random>
+
+class vector_insert_bench final
+{
+	std::vector<std::byte> m_buffer;
+public:
+	constexpr static std::string_view name = "std::vector insert";
+	
+	template <typename T>
+	void Run(const T& data)
+	{
+		for (const auto& i : data)
+		{
+			auto bytes = reinterpret_cast<const std::byte*>(&i);
+			m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(i));
+		}
+	}
+};
+
+class output_memory_stream_bench final
+{
+	std::io::output_memory_stream m_stream;
+	std::io::default_context<std::io::output_memory_stream> m_context;
+public:
+	constexpr static std::string_view name =
+		"std::io::output_memory_stream";
+	
+	output_memory_stream_bench()
+		: m_context{m_stream}
+	{
+	}
+	
+	template <typename T>
+	void Run(const T& data)
+	{
+		for (const auto& i : data)
+		{
+			std::io::write(i, m_context);
+		}
+	}
+};
+
+class reserved_output_memory_stream_bench final
+{
+	using stream_type = std::io::basic_output_memory_stream<
+		std::vector<std::byte>, std::io::exact_growth>;
+	
+	stream_type m_stream;
+	std::io::default_context<stream_type> m_context;
+public:
+	constexpr static std::string_view name =
+		"Reserved std::io::output_memory_stream";
+	
+	reserved_output_memory_stream_bench()
+		: m_context{m_stream}
+	{
+	}
+	
+	template <typename T>
+	void Run(const T& data)
+	{
+		m_stream.reserve(std::size(data) * sizeof(typename T::value_type));
+		for (const auto& i : data)
+		{
+			std::io::write(i, m_context);
+		}
+	}
+};
+
+class uninitialized_output_memory_stream_bench final
+{
+	std::io::basic_output_memory_stream<std::vector<std::byte,
+		std::io::default_init_allocator<std::byte>>> m_stream;
+public:
+	constexpr static std::string_view name =
+		"Uninitialized std::io::output_memory_stream";
+	
+	template <typename T>
+	void Run(const T& data)
+	{
+		for (const auto& i : data)
+		{
+			auto bytes = m_stream.write_uninitialized(sizeof(i));
+			std::memcpy(bytes.data(), &i, sizeof(i));
+		}
+	}
+};
+
+template <typename B>
+void Benchmark(const auto& data)
+{
+	std::cout << B::name;
+	B b;
+	auto start_time = std::chrono::high_resolution_clock::now();
+	try
+	{
+		b.Run(data);
+	}
+	catch (std::exception& e)
+	{
+		std::cout << ": FAILED\n";
+		std::cout << "Reason: " << e.what() << '\n';
+		return;
+	}
+	catch (...)
+	{
+		std::cout << ": FAILED\n";
+		std::cout << "Reason: Unknown exception.\n";
+		return;
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double, std::milli> time_elapsed = end_time -
+		start_time;
+	std::cout << ": " << time_elapsed.count() << " ms\n";
+}
+
+int main()
+{
+	std::vector<std::uint64_t> numbers;
+	numbers.resize(10'000'000);
+	for (auto&& number : numbers)
+	{
+		number = std::experimental::randint<std::uint64_t>(
+			std::numeric_limits<std::uint64_t>::min(),
+			std::numeric_limits<std::uint64_t>::max());
+	}
+	Benchmark<vector_insert_bench>(numbers);
+	Benchmark<output_memory_stream_bench>(numbers);
+	Benchmark<reserved_output_memory_stream_bench>(numbers);
+	Benchmark<uninitialized_output_memory_stream_bench>(numbers);
+}
@@ -0,0 +1,143 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <io>
+#include <experimental/random>
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using layout = std::io::record_layout<29,
+	std::io::record_field<std::uint64_t, 0, std::endian::big>,
+	std::io::record_field<std::uint32_t, 8, std::endian::big>,
+	std::io::record_field<std::uint16_t, 12, std::endian::big>,
+	std::io::record_field<std::uint64_t, 14, std::endian::big>>;
+
+constexpr std::size_t record_count = 1'000'000;
+
+class per_record_bench final
+{
+	std::vector<std::uint64_t> m_a;
+	std::vector<std::uint32_t> m_b;
+	std::vector<std::uint16_t> m_c;
+	std::vector<std::uint64_t> m_d;
+public:
+	constexpr static std::string_view name = "record_layout::read";
+	
+	per_record_bench()
+		: m_a(record_count), m_b(record_count), m_c(record_count),
+		m_d(record_count)
+	{
+	}
+	
+	void Run(const std::vector<std::byte>& data)
+	{
+		std::io::input_span_stream stream{data};
+		for (std::size_t i = 0; i < record_count; ++i)
+		{
+			std::tie(m_a[i], m_b[i], m_c[i], m_d[i]) = layout::read(stream);
+		}
+	}
+};
+
+class read_columns_bench final
+{
+	std::vector<std::uint64_t> m_a;
+	std::vector<std::uint32_t> m_b;
+	std::vector<std::uint16_t> m_c;
+	std::vector<std::uint64_t> m_d;
+public:
+	constexpr static std::string_view name = "record_layout::read_columns";
+	
+	read_columns_bench()
+		: m_a(record_count), m_b(record_count), m_c(record_count),
+		m_d(record_count)
+	{
+	}
+	
+	void Run(const std::vector<std::byte>& data)
+	{
+		std::io::input_span_stream stream{data};
+		layout::read_columns(stream, std::span{m_a}, std::span{m_b},
+			std::span{m_c}, std::span{m_d});
+	}
+};
+
+template <typename B>
+void Benchmark(const auto& data)
+{
+	std::cout << B::name;
+	B b;
+	auto start_time = std::chrono::high_resolution_clock::now();
+	try
+	{
+		b.Run(data);
+	}
+	catch (std::exception& e)
+	{
+		std::cout << ": FAILED\n";
+		std::cout << "Reason: " << e.what() << '\n';
+		return;
+	}
+	catch (...)
+	{
+		std::cout << ": FAILED\n";
+		std::cout << "Reason: Unknown exception.\n";
+		return;
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double, std::milli> time_elapsed = end_time -
+		start_time;
+	std::cout << ": " << time_elapsed.count() << " ms\n";
+}
+
+// Gathers must not read outside of the records. Place 4-byte records with a
+// 2-byte field at offset 1 right after the inaccessible page.
+bool CheckFieldAtRecordStart()
+{
+#if __has_include(<sys/mman.h>)
+	using field = std::io::record_field<std::uint16_t, 1, std::endian::little>;
+	constexpr std::size_t count = 64;
+	auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+	auto memory = ::mmap(nullptr, page_size * 2, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (memory == MAP_FAILED)
+	{
+		return true;
+	}
+	::mprotect(memory, page_size, PROT_NONE);
+	auto records = static_cast<std::byte*>(memory) + page_size;
+	for (std::size_t i = 0; i < count * 4; ++i)
+	{
+		records[i] = static_cast<std::byte>(i);
+	}
+	std::vector<std::uint16_t> column(count);
+	std::io::Utilities::ExtractColumn<4, field>({records, count * 4}, column);
+	bool result = true;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		result = result && (column[i] == field::decode({records + i * 4, 4}));
+	}
+	::munmap(memory, page_size * 2);
+	return result;
+#else
+	return true;
+#endif
+}
+
+int main()
+{
+	if (!CheckFieldAtRecordStart())
+	{
+		std::cout << "ExtractColumn: FAILED\n";
+		return EXIT_FAILURE;
+	}
+	std::vector<std::byte> data(record_count * layout::size);
+	for (auto& b : data)
+	{
+		b = static_cast<std::byte>(std::experimental::randint(0, 255));
+	}
+	Benchmark<per_record_bench>(data);
+	Benchmark<read_columns_bench>(data);
+}
@@ -0,0 +1,119 @@
+#include <iostream>
+#include <chrono>
+#include <io>
+
+constexpr std::size_t buffer_size = 1 << 16;
+constexpr std::size_t iterations = 1 << 10;
+
+template <std::size_t N>
+class input_span_stream_bench final
+{
+	std::vector<std::byte> m_buffer;
+	std::array<std::byte, N> m_chunk;
+	std::size_t m_checksum = 0;
+public:
+	constexpr static std::string_view name = "std::io::input_span_stream";
+	
+	input_span_stream_bench()
+		: m_buffer(buffer_size, std::byte{1})
+	{
+	}
+	
+	void Run()
+	{
+		std::io::input_span_stream stream{m_buffer};
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			stream.seek_position(std::io::position{0});
+			for (std::size_t j = 0; j < buffer_size / N; ++j)
+			{
+				std::io::read_raw(m_chunk, stream);
+				m_checksum += static_cast<std::size_t>(m_chunk[0]);
+			}
+		}
+	}
+	
+	std::size_t GetChecksum() const noexcept
+	{
+		return m_checksum;
+	}
+};
+
+template <std::size_t N>
+class output_span_stream_bench final
+{
+	std::vector<std::byte> m_buffer;
+	std::array<std::byte, N> m_chunk;
+	std::size_t m_checksum = 0;
+public:
+	constexpr static std::string_view name = "std::io::output_span_stream";
+	
+	output_span_stream_bench()
+		: m_buffer(buffer_size)
+	{
+		m_chunk.fill(std::byte{1});
+	}
+	
+	void Run()
+	{
+		std::io::output_span_stream stream{m_buffer};
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			stream.seek_position(std::io::position{0});
+			for (std::size_t j = 0; j < buffer_size / N; ++j)
+			{
+				std::io::write_raw(m_chunk, stream);
+			}
+			m_checksum += static_cast<std::size_t>(m_buffer[i % buffer_size]);
+		}
+	}
+	
+	std::size_t GetChecksum() const noexcept
+	{
+		return m_checksum;
+	}
+};
+
+template <template <std::size_t> typename B, std::size_t N>
+void Benchmark()
+{
+	std::cout << B<N>::name << ", " << N << " bytes";
+	B<N> b;
+	auto start_time = std::chrono::high_resolution_clock::now();
+	try
+	{
+		b.Run();
+	}
+	catch (std::exception& e)
+	{
+		std::cout << ": FAILED\n";
+		std::cout << "Reason: " << e.what() << '\n';
+		return;
+	}
+	catch (...)
+	{
+		std::cout << ": FAILED\n";
+		std::cout << "Reason: Unknown exception.\n";
+		return;
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double, std::milli> time_elapsed = end_time -
+		start_time;
+	std::chrono::duration<double> seconds = time_elapsed;
+	auto gigabytes = static_cast<double>(buffer_size * iterations) / 1e9;
+	std::cout << ": " << time_elapsed.count() << " ms, " <<
+		gigabytes / seconds.count() << " GB/s (checksum " << b.GetChecksum() <<
+		")\n";
+}
+
+template <template <std::size_t> typename B, std::size_t... N>
+void BenchmarkSizes(std::index_sequence<N...>)
+{
+	(Benchmark<B, std::size_t{1} << N>(), ...);
+}
+
+int main()
+{
+	BenchmarkSizes<input_span_stream_bench>(std::make_index_sequence<7>{});
+	BenchmarkSizes<output_span_stream_bench>(std::make_index_sequence<7>{});
+}
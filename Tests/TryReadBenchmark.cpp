@@ -0,0 +1,112 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <io>
+
+constexpr std::size_t iterations = 1 << 12;
+
+struct record
+{
+	std::uint32_t id;
+	std::vector<std::uint64_t> timestamps;
+	std::array<std::uint64_t, 4> sums;
+	std::string name;
+};
+
+bool operator==(const record& lhs, const record& rhs)
+{
+	return (lhs.id == rhs.id) && (lhs.timestamps == rhs.timestamps) &&
+		(lhs.sums == rhs.sums) && (lhs.name == rhs.name);
+}
+
+std::string_view GetName(std::io::integer_format f)
+{
+	switch (f)
+	{
+		case std::io::integer_format::fixed:
+		{
+			return "fixed";
+		}
+		case std::io::integer_format::leb128:
+		{
+			return "leb128";
+		}
+		case std::io::integer_format::group_varint:
+		{
+			return "group_varint";
+		}
+		default:
+		{
+			return "delta_bit_packed";
+		}
+	}
+}
+
+// try_read must complete on every complete buffer and must not complete on
+// any truncated one.
+template <typename T>
+bool Benchmark(const T& value, std::string_view type_name,
+	std::io::integer_format f)
+{
+	std::io::format fmt{std::endian::little,
+		std::io::floating_point_format::native, f};
+	std::io::output_memory_stream output;
+	std::io::default_context output_context{output, fmt};
+	std::io::write(value, output_context);
+	const auto& data = output.get_buffer();
+	std::cout << type_name << ", " << GetName(f) << ", " << data.size()
+		<< " bytes";
+	T result;
+	auto start_time = std::chrono::high_resolution_clock::now();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		std::io::input_span_stream stream{data};
+		std::io::default_context context{stream, fmt};
+		if ((std::io::try_read(result, context) !=
+			std::io::read_status::complete) || !(result == value))
+		{
+			std::cout << ": FAILED\n";
+			std::cout << "Reason: Complete buffer was not read.\n";
+			return false;
+		}
+	}
+	auto end_time = std::chrono::high_resolution_clock::now();
+	std::io::input_span_stream stream{
+		std::span{data}.first(data.size() - 1)};
+	std::io::default_context context{stream, fmt};
+	if (std::io::try_read(result, context) !=
+		std::io::read_status::need_more_bytes)
+	{
+		std::cout << ": FAILED\n";
+		std::cout << "Reason: Truncated buffer was read.\n";
+		return false;
+	}
+	std::chrono::duration<double, std::micro> time_elapsed = end_time -
+		start_time;
+	std::cout << ": " << time_elapsed.count() / iterations << " us\n";
+	return true;
+}
+
+int main()
+{
+	std::vector<std::uint64_t> strided(1000);
+	for (std::size_t i = 0; i < strided.size(); ++i)
+	{
+		strided[i] = (i + 1) * 16;
+	}
+	std::vector<std::uint32_t> small(1000, 7);
+	record r{42, strided, {1, 2, 3, 4}, "record"};
+	std::map<std::uint32_t, std::vector<std::uint64_t>> series{{1, strided},
+		{2, {}}};
+	bool result = true;
+	for (auto f : {std::io::integer_format::fixed,
+		std::io::integer_format::leb128, std::io::integer_format::group_varint,
+		std::io::integer_format::delta_bit_packed})
+	{
+		result = Benchmark(strided, "std::vector<std::uint64_t>", f) && result;
+		result = Benchmark(small, "std::vector<std::uint32_t>", f) && result;
+		result = Benchmark(r, "aggregate", f) && result;
+		result = Benchmark(series, "std::map", f) && result;
+	}
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}